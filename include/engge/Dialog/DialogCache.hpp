@@ -0,0 +1,40 @@
+#pragma once
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include "engge/Parsers/YackParser.hpp"
+
+namespace ng {
+/// @brief A dialog parsed once with an index of its labels.
+struct CompiledDialog {
+  std::unique_ptr<Ast::CompilationUnit> pCompilationUnit;
+  /// Index of each label in the compilation unit, when a label is defined several times the last one wins.
+  std::unordered_map<std::string, size_t> labels;
+
+  /// Gets the index of the label with the given name.
+  [[nodiscard]] std::optional<size_t> findLabel(const std::string &name) const;
+};
+
+/// @brief Keeps the dialogs (.byack) once parsed.
+///
+/// Starting a dialog already started is a lookup in this cache.
+/// When the preference `EnggeDialogWarmUp` is enabled, all the dialogs of the packs
+/// are parsed at startup.
+class DialogCache {
+public:
+  DialogCache();
+
+  /// Gets the dialog with the given name (without the .byack extension), parses it if necessary.
+  std::shared_ptr<const CompiledDialog> get(const std::string &name);
+  /// Parses all the dialogs found in the packs.
+  void warmUp();
+  void clear();
+
+private:
+  static std::shared_ptr<const CompiledDialog> compile(const std::string &name);
+
+private:
+  std::unordered_map<std::string, std::shared_ptr<const CompiledDialog>> m_dialogs;
+};
+} // namespace ng
@@ -0,0 +1,80 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace ng {
+enum class DialogConditionMode {
+  Once,
+  ShowOnce,
+  OnceEver,
+  ShowOnceEver,
+  TempOnce
+};
+
+struct DialogConditionState {
+public:
+  DialogConditionMode mode;
+  std::string actorKey;
+  std::string dialog;
+  int32_t line;
+};
+
+/// @brief Stores the states of the dialog conditions (once, showonce, onceever, etc.) already reached.
+///
+/// The states are hashed by mode, dialog, line and actor, the dialog and actor names are interned,
+/// so checking a condition doesn't depend on the number of states recorded during the game.
+class DialogConditionStates {
+public:
+  /// Adds a state, does nothing if it has already been added.
+  void add(const DialogConditionState &state);
+  /// Indicates whether a state has been added for this actor.
+  [[nodiscard]] bool contains(DialogConditionMode mode,
+                              const std::string &dialog,
+                              int32_t line,
+                              const std::string &actor) const;
+  /// Indicates whether a state has been added for any actor.
+  [[nodiscard]] bool contains(DialogConditionMode mode, const std::string &dialog, int32_t line) const;
+  /// Removes all the states with the specified mode.
+  void remove(DialogConditionMode mode);
+  void clear();
+
+  /// Calls the specified function for each state.
+  template<typename TFunc>
+  void forEach(TFunc func) const {
+    for (const auto &key : m_states) {
+      func(DialogConditionState{key.mode, m_names[key.actor], m_names[key.dialog], key.line});
+    }
+  }
+
+private:
+  struct Key {
+    DialogConditionMode mode;
+    uint32_t dialog;
+    int32_t line;
+    uint32_t actor;
+
+    bool operator==(const Key &other) const {
+      return mode == other.mode && dialog == other.dialog && line == other.line && actor == other.actor;
+    }
+  };
+
+  struct KeyHash {
+    size_t operator()(const Key &key) const;
+  };
+
+  static constexpr uint32_t AnyActor = UINT32_MAX;
+
+  uint32_t intern(const std::string &name);
+  [[nodiscard]] bool find(const std::string &name, uint32_t &id) const;
+
+private:
+  std::vector<std::string> m_names;
+  std::unordered_map<std::string, uint32_t> m_ids;
+  std::unordered_set<Key, KeyHash> m_states;
+  /// Number of states for each key without its actor.
+  std::unordered_map<Key, size_t, KeyHash> m_actorCounts;
+};
+} // namespace ng
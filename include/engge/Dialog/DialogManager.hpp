@@ -6,6 +6,7 @@
 #include "engge/Engine/Function.hpp"
 #include "DialogPlayer.hpp"
 #include "engge/Graphics/GGFont.hpp"
+#include "engge/Graphics/Text.hpp"
 #include "EngineDialogScript.hpp"
 
 namespace ng {
@@ -16,6 +17,8 @@ struct DialogSlot {
   std::wstring text;
   const Ast::Statement *pChoice{nullptr};
   mutable glm::vec2 pos;
+  /// Text displayed for this choice, kept to lay out its glyphs only when the choice changes.
+  mutable ng::Text label;
 };
 
 class DialogManager final : public ngf::Drawable {
@@ -26,8 +29,8 @@ public:
 
   void setMousePosition(glm::vec2 pos);
 
-  const std::vector<DialogConditionState> &getStates() const { return m_pPlayer->getStates(); }
-  std::vector<DialogConditionState> &getStates() { return m_pPlayer->getStates(); }
+  [[nodiscard]] const DialogConditionStates &getStates() const { return m_pPlayer->getStates(); }
+  DialogConditionStates &getStates() { return m_pPlayer->getStates(); }
   [[nodiscard]] DialogManagerState getState() const { return m_state; }
   void choose(int choice);
 
@@ -36,6 +39,8 @@ public:
 private:
   void updateChoices(const ngf::TimeSpan &elapsed);
   void updateDialogSlots();
+  [[nodiscard]] const GGFont &getFont() const;
+  const ng::Text &getSlotLabel(const DialogSlot &slot, const GGFont &font, float y) const;
   static void onDialogEnded();
 
 private:
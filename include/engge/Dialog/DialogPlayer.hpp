@@ -3,6 +3,8 @@
 #include <ngf/System/TimeSpan.h>
 #include "DialogContextAbstract.hpp"
 #include "DialogConditionAbstract.hpp"
+#include "DialogCache.hpp"
+#include "DialogConditionStates.hpp"
 
 namespace ng {
 
@@ -21,22 +23,6 @@ enum class DialogPlayerState {
   WaitingForSayingChoice
 };
 
-enum class DialogConditionMode {
-  Once,
-  ShowOnce,
-  OnceEver,
-  ShowOnceEver,
-  TempOnce
-};
-
-struct DialogConditionState {
-public:
-  DialogConditionMode mode;
-  std::string actorKey;
-  std::string dialog;
-  int32_t line;
-};
-
 class DialogScriptAbstract;
 class DialogPlayer final : public DialogContextAbstract, public DialogConditionAbstract {
 private:
@@ -55,8 +41,8 @@ public:
   [[nodiscard]] std::string getDialogName() const { return m_dialogName; }
 
   [[nodiscard]] const std::array<const Ast::Statement *, 9> &getChoices() const { return m_choices; }
-  [[nodiscard]] const std::vector<DialogConditionState>& getStates() const { return m_states; }
-  std::vector<DialogConditionState>& getStates() { return m_states; }
+  [[nodiscard]] const DialogConditionStates &getStates() const { return m_states; }
+  DialogConditionStates &getStates() { return m_states; }
 
 private:
   void resetState();
@@ -95,9 +81,10 @@ private:
 
 private:
   std::string m_dialogName;
-  std::unique_ptr<Ast::CompilationUnit> m_pCompilationUnit;
+  std::shared_ptr<const CompiledDialog> m_pDialog;
   std::array<const Ast::Statement *, 9> m_choices{};
   Ast::Label *m_pLabel{nullptr};
+  size_t m_labelIndex{0};
   int m_currentStatement{0};
   DialogPlayerState m_state{DialogPlayerState::None};
   std::string m_actor;
@@ -106,7 +93,7 @@ private:
   int m_limit{6};
   std::string m_overrideLabel;
   std::function<bool()> m_pWaitAction{nullptr};
-  std::vector<DialogConditionState> m_states;
+  DialogConditionStates m_states;
   std::string m_nextLabel;
 };
 }
\ No newline at end of file
@@ -0,0 +1,110 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <ngf/IO/GGPackValue.h>
+
+namespace ng {
+/// @brief Writes the binary form of a decoded asset.
+class AssetCacheWriter {
+public:
+  template<typename T>
+  void write(const T &value) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    auto pValue = reinterpret_cast<const char *>(&value);
+    m_data.insert(m_data.end(), pValue, pValue + sizeof(T));
+  }
+
+  template<typename TChar>
+  void writeString(const std::basic_string<TChar> &text) {
+    write(static_cast<uint32_t>(text.size()));
+    auto pText = reinterpret_cast<const char *>(text.data());
+    m_data.insert(m_data.end(), pText, pText + text.size() * sizeof(TChar));
+  }
+
+  [[nodiscard]] const std::vector<char> &getData() const { return m_data; }
+
+private:
+  std::vector<char> m_data;
+};
+
+/// @brief Reads the binary form of a decoded asset written by an AssetCacheWriter.
+///
+/// Reading past the end of the data doesn't throw, it sets the reader in an error state.
+class AssetCacheReader {
+public:
+  explicit AssetCacheReader(const std::vector<char> &data) : m_data(data) {}
+
+  template<typename T>
+  T read() {
+    static_assert(std::is_trivially_copyable_v<T>);
+    T value{};
+    if (!canRead(sizeof(T)))
+      return value;
+    memcpy(&value, m_data.data() + m_offset, sizeof(T));
+    m_offset += sizeof(T);
+    return value;
+  }
+
+  template<typename TChar>
+  std::basic_string<TChar> readString() {
+    auto size = read<uint32_t>();
+    if (!canRead(size * sizeof(TChar)))
+      return {};
+    std::basic_string<TChar> text(size, TChar{});
+    memcpy(text.data(), m_data.data() + m_offset, size * sizeof(TChar));
+    m_offset += size * sizeof(TChar);
+    return text;
+  }
+
+  [[nodiscard]] bool isValid() const { return m_isValid; }
+  [[nodiscard]] bool eof() const { return m_offset >= m_data.size(); }
+
+private:
+  bool canRead(size_t size) {
+    m_isValid = m_isValid && m_offset + size <= m_data.size();
+    return m_isValid;
+  }
+
+private:
+  const std::vector<char> &m_data;
+  size_t m_offset{0};
+  bool m_isValid{true};
+};
+
+/// @brief Opt-in cache on disk of the decoded form of the assets.
+///
+/// The cached forms are keyed by entry name and are invalidated when the file
+/// containing the entry (pack or override file) changes.
+/// Can be used from the asset loader workers.
+class AssetCache {
+public:
+  AssetCache();
+
+  [[nodiscard]] bool isEnabled() const { return m_isEnabled; }
+  [[nodiscard]] std::filesystem::path getPath() const { return m_path; }
+
+  /// Reads the cached form of an entry of the given kind.
+  /// Returns false if the cache is disabled, if there is no cached form or if it is out of date.
+  bool read(const std::string &kind, const std::string &entry, std::vector<char> &data) const;
+  /// Writes the cached form of an entry of the given kind, does nothing if the cache is disabled.
+  void write(const std::string &kind, const std::string &entry, const std::vector<char> &data) const;
+  /// Removes all the cached forms.
+  void clear();
+
+  /// Reads a hash entry (like a .wimpy or an animation file) from the cache if possible,
+  /// otherwise from the packs and then caches it.
+  [[nodiscard]] ngf::GGPackValue readHashEntry(const std::string &entry) const;
+
+private:
+  [[nodiscard]] std::filesystem::path getFilePath(const std::string &kind, const std::string &entry) const;
+
+private:
+  std::filesystem::path m_path;
+  std::atomic<bool> m_isEnabled{false};
+};
+} // namespace ng
@@ -1,4 +1,5 @@
 #pragma once
+#include <functional>
 #include <memory>
 #include <squirrel.h>
 #include <ngf/Graphics/RenderWindow.h>
@@ -75,6 +76,8 @@ public:
   Room *getRoom();
   SQInteger setRoom(Room *pRoom);
   SQInteger enterRoomFromDoor(Object *pDoor);
+  /// Starts to load in background the assets of a room before entering it.
+  void prefetchRoom(Room *pRoom);
 
   [[nodiscard]] static std::wstring getText(int id);
   [[nodiscard]] static std::wstring getText(const std::string &text);
@@ -129,6 +132,8 @@ public:
   void startDialog(const std::string &dialog, const std::string &node);
   void execute(const std::string &code);
   bool executeCondition(const std::string &code);
+  /// Compiles a condition once to evaluate it each frame.
+  std::function<bool()> compileCondition(const std::string &code);
   std::string executeDollar(const std::string &code);
 
   SoundDefinition *getSoundDefinition(const std::string &name);
@@ -1,12 +1,23 @@
 #pragma once
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <memory>
 #include <filesystem>
+#include <mutex>
+#include <unordered_map>
 #include <ngf/IO/GGPackValue.h>
 #include <ngf/IO/GGPack.h>
+#include <engge/Engine/EntryView.hpp>
 
 namespace ng {
+/// @brief Virtual file system used to read the game assets.
+///
+/// The entries are indexed once by `loadPacks`, a lookup is then a single hash probe.
+/// When an entry exists in several places, the precedence is:
+///   1. a file in the dev override directory (the working directory),
+///   2. the first ggpack, in alphabetical order, containing the entry.
+/// Entry names are case insensitive.
 class EngineSettings {
 public:
   using iterator = std::vector<std::unique_ptr<ngf::GGPack>>::iterator;
@@ -20,7 +31,13 @@ public:
 
   bool hasEntry(const std::string &name);
   [[nodiscard]] std::vector<char> readBuffer(const std::string &name) const;
+  /// Reads an entry without copying it: override files are memory mapped
+  /// and pack entries are decoded once in a buffer owned by the view.
+  [[nodiscard]] EntryView readView(const std::string &name) const;
   [[nodiscard]] ngf::GGPackValue readEntry(const std::string &name) const;
+  /// Gets a stamp identifying the version of the file containing the entry (its size and
+  /// modification time) or 0 if the entry doesn't exist.
+  [[nodiscard]] uint64_t getEntryStamp(const std::string &name) const;
 
   iterator begin() { return m_packs.begin(); }
   iterator end() { return m_packs.end(); }
@@ -28,7 +45,26 @@ public:
   [[nodiscard]] const_iterator cbegin() const { return m_packs.cbegin(); }
   [[nodiscard]] const_iterator cend() const { return m_packs.cend(); }
 
+private:
+  struct Entry {
+    std::string name;                ///< name of the entry as stored in the pack
+    ngf::GGPack *pPack{nullptr};     ///< pack containing the entry or nullptr for an override file
+    std::filesystem::path path;      ///< path of the override file
+    uint64_t stamp{0};               ///< version of the file containing the entry
+  };
+
+  void indexOverrides(const std::filesystem::path &path);
+  void indexPack(ngf::GGPack &pack, uint64_t stamp);
+  static uint64_t getFileStamp(const std::filesystem::path &path);
+  [[nodiscard]] const Entry *findEntry(const std::string &name) const;
+  /// Reads an override file, throws the same error as a missing entry if it can't be read anymore.
+  static std::vector<char> readFile(const std::filesystem::path &path, const std::string &name);
+
 private:
   std::vector<std::unique_ptr<ngf::GGPack>> m_packs;
+  std::unordered_map<std::string, Entry> m_entries;
+  /// Packs are read from the main thread and from the asset loader workers.
+  /// The index is only written by `loadPacks` and doesn't need to be locked.
+  mutable std::mutex m_mutex;
 };
 } // namespace ng
@@ -1,5 +1,8 @@
 #pragma once
+#include <memory>
+#include <unordered_map>
 #include <squirrel.h>
+#include <engge/Engine/HandleTable.hpp>
 #include <engge/Room/Room.hpp>
 #include <engge/Engine/Engine.hpp>
 #include <engge/Engine/Light.hpp>
@@ -41,6 +44,15 @@ public:
   inline void setCallbackId(int id) { m_callbackId = id - START_CALLBACKID; }
   inline int getThreadId() { return START_THREADID + m_threadId++; }
 
+  /// Registers an actor, a room, an object or a light so it can be found by its ID.
+  void addScriptObject(ScriptObject *pObject);
+  void removeScriptObject(const ScriptObject *pObject);
+  /// Registers a thread so it can be found by its ID or by its VM.
+  void addThread(ThreadBase *pThread);
+  void removeThread(const ThreadBase *pThread);
+  /// Registers a sound, the sound is forgotten as soon as it is released.
+  void addSound(const std::shared_ptr<Sound> &sound);
+
   static Actor *getActorFromId(int id);
   static Room *getRoomFromId(int id);
   static Object *getObjectFromId(int id);
@@ -74,6 +86,7 @@ public:
 
 private:
   static inline bool isBetween(int id, int min, int max) { return id >= min && id < max; }
+  static Light *getLightFromId(int id);
 
 private:
   int m_actorId{0};
@@ -83,6 +96,11 @@ private:
   int m_soundId{0};
   int m_callbackId{0};
   int m_threadId{0};
+  HandleTable<ScriptObject> m_scriptObjects;
+  HandleTable<ThreadBase> m_threads;
+  std::unordered_map<HSQUIRRELVM, int> m_threadIds;
+  std::unordered_map<int, std::weak_ptr<Sound>> m_sounds;
+  std::size_t m_soundsSweepSize{64};
 };
 
 template<typename TScriptObject>
@@ -129,13 +147,7 @@ TScriptObject *EntityManager::getScriptObjectFromId(int id) {
   }
 
   if (EntityManager::isLight(id)) {
-    for (auto &&room : ng::Locator<ng::Engine>::get().getRooms()) {
-      for (auto &light : room->getLights()) {
-        if (light.getId() == id)
-          return dynamic_cast<TScriptObject *>(&light);
-      }
-    }
-    return nullptr;
+    return dynamic_cast<TScriptObject *>(getLightFromId(id));
   }
 
   if (EntityManager::isObject(id)) {
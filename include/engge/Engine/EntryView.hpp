@@ -0,0 +1,38 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace ng {
+/// @brief Read-only view on the content of an entry of the virtual file system.
+///
+/// The view keeps alive the storage of the entry: a memory mapped file or the buffer
+/// decoded from a pack, the content can be given to a decoder without being copied.
+class EntryView {
+public:
+  EntryView() = default;
+  EntryView(std::shared_ptr<const void> owner, const char *data, size_t size)
+      : m_owner(std::move(owner)), m_data(data), m_size(size) {}
+
+  /// Creates a view owning a decoded buffer.
+  static EntryView fromBuffer(std::vector<char> buffer) {
+    auto pBuffer = std::make_shared<std::vector<char>>(std::move(buffer));
+    auto data = pBuffer->data();
+    auto size = pBuffer->size();
+    return EntryView(std::move(pBuffer), data, size);
+  }
+
+  [[nodiscard]] const char *data() const { return m_data; }
+  [[nodiscard]] size_t size() const { return m_size; }
+  [[nodiscard]] bool empty() const { return m_size == 0; }
+
+  [[nodiscard]] const char *begin() const { return m_data; }
+  [[nodiscard]] const char *end() const { return m_data + m_size; }
+
+private:
+  std::shared_ptr<const void> m_owner;
+  const char *m_data{nullptr};
+  size_t m_size{0};
+};
+} // namespace ng
@@ -0,0 +1,29 @@
+#pragma once
+#include <cstddef>
+#include <unordered_map>
+
+namespace ng {
+/// Table mapping script object IDs to live objects in O(1).
+///
+/// An object is registered when it is created and removed when it is destroyed,
+/// so a lookup never returns a dangling pointer.
+template<typename TObject>
+class HandleTable {
+public:
+  void add(int id, TObject *pObject) { m_objects[id] = pObject; }
+
+  void remove(int id) { m_objects.erase(id); }
+
+  [[nodiscard]] TObject *get(int id) const {
+    auto it = m_objects.find(id);
+    if (it == m_objects.end())
+      return nullptr;
+    return it->second;
+  }
+
+  [[nodiscard]] std::size_t size() const { return m_objects.size(); }
+
+private:
+  std::unordered_map<int, TObject *> m_objects;
+};
+}
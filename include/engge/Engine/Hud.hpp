@@ -1,4 +1,7 @@
 #pragma once
+#include <memory>
+#include <vector>
+#include <ngf/Graphics/Vertex.h>
 #include "engge/Entities/Entity.hpp"
 #include "engge/Entities/Actor.hpp"
 #include "Verb.hpp"
@@ -51,10 +54,14 @@ public:
   void setActive(bool active);
   [[nodiscard]] bool getActive() const { return m_active; }
 
+  /// Indicates that the user preferences have changed, the verbs and the inventory are composed again.
+  void invalidatePreferences();
+
   void draw(ngf::RenderTarget &target, ngf::RenderStates states) const final;
 
 private:
   static std::string getVerbName(const Verb &verb);
+  void composeVerbs(int highlightedVerbId) const;
 
 private:
   std::array<VerbSlot, 6> m_verbSlots;
@@ -71,5 +78,14 @@ private:
   State m_state{State::Off};
   float m_alpha{1.f};
   bool m_isVisible{true};
+  // verbs and backing composed when the actor, its verbs, the highlighted verb, the alpha or the preferences change
+  mutable std::vector<ngf::Vertex> m_backingVertices;
+  mutable std::vector<ngf::Vertex> m_verbVertices;
+  mutable std::shared_ptr<ngf::Texture> m_pGameTexture;
+  mutable std::shared_ptr<ngf::Texture> m_pVerbTexture;
+  mutable bool m_isDirty{true};
+  mutable int m_composedActorIndex{-1};
+  mutable int m_composedVerbId{-1};
+  mutable float m_composedAlpha{-1.f};
 };
 }
@@ -1,5 +1,9 @@
 #pragma once
 #include <array>
+#include <memory>
+#include <string>
+#include <vector>
+#include <ngf/Graphics/Vertex.h>
 #include "engge/Graphics/Screen.hpp"
 #include "engge/Graphics/SpriteSheet.hpp"
 
@@ -20,14 +24,37 @@ public:
   void setVerbUiColors(const VerbUiColors *pColors) { m_pColors = pColors; }
   void setAlpha(float alpha) { m_alpha = alpha;}
   [[nodiscard]] float getAlpha() const {return m_alpha;}
+  /// Indicates that the user preferences have changed, the inventory panel is composed again.
+  void invalidatePreferences() { m_isPanelDirty = true; }
 
   void draw(ngf::RenderTarget &target, ngf::RenderStates states) const final;
 
 private:
-  void drawUpArrow(ngf::RenderTarget &target) const;
-  void drawDownArrow(ngf::RenderTarget &target) const;
+  /// State of the panel (slots backgrounds and arrows) when it has been composed.
+  struct PanelState {
+    bool hasUpArrow{false};
+    bool hasDownArrow{false};
+    ngf::Color backgroundColor;
+    ngf::Color arrowColor;
+  };
+
+  /// Object displayed in an inventory slot with the frame of its icon.
+  struct Slot {
+    const Object *pObject{nullptr};
+    std::string icon;
+    ngf::irect rect;
+    glm::vec2 origin{0, 0};
+    /// Indicates whether the object was jiggling or popping when the items were composed.
+    bool isAnimated{false};
+  };
+
+  void composePanel(const PanelState &state) const;
+  void appendArrow(const std::string &name, const ngf::frect &rect, ngf::Color color) const;
+  bool updateSlots() const;
+  void composeItems() const;
   [[nodiscard]] bool hasUpArrow() const;
   [[nodiscard]] bool hasDownArrow() const;
+  static bool equals(const PanelState &state1, const PanelState &state2);
 
 private:
   SpriteSheet m_gameSheet, m_inventoryItems;
@@ -42,5 +69,13 @@ private:
   const VerbUiColors *m_pColors{nullptr};
   float m_alpha{1.f};
   bool m_mouseWasDown{false};
+  mutable std::vector<ngf::Vertex> m_panelVertices;
+  mutable std::vector<ngf::Vertex> m_itemVertices;
+  mutable std::shared_ptr<ngf::Texture> m_pGameTexture;
+  mutable std::shared_ptr<ngf::Texture> m_pItemsTexture;
+  mutable PanelState m_panelState;
+  mutable bool m_isPanelDirty{true};
+  mutable std::array<Slot, 8> m_slots;
+  mutable float m_composedItemsAlpha{-1.f};
 };
 } // namespace ng
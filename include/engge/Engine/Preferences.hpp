@@ -38,6 +38,10 @@ static const std::string KeySelectNext = "keySelectNext";
 // engge only
 static const std::string EnggeGameSpeedFactor = "gameSpeedFactor";
 static const std::string EnggeDevPath = "devPath";
+static const std::string EnggeTextureBudget = "textureBudget";
+static const std::string EnggeSpriteSheetBudget = "spriteSheetBudget";
+static const std::string EnggeAssetCache = "assetCache";
+static const std::string EnggeDialogWarmUp = "dialogWarmUp";
 static const bool EnggeDebug = false;
 }
 
@@ -73,6 +77,10 @@ static const std::string KeySelectNext = "0";
 static const bool AnnoyingInJokes = false;
 static const std::string EnggeDevPath = "";
 static const float EnggeGameSpeedFactor = 1.f;
+static const int EnggeTextureBudget = 512; // in MB
+static const int EnggeSpriteSheetBudget = 32; // in MB
+static const bool EnggeAssetCache = false;
+static const bool EnggeDialogWarmUp = false;
 static const bool EnggeDebug = false;
 }
 
@@ -11,6 +11,10 @@ public:
   [[nodiscard]] std::wstring getText(int id) const;
   [[nodiscard]] std::wstring getText(const std::string &text) const;
 
+private:
+  bool loadFromCache(const std::string &path);
+  void saveToCache(const std::string &path) const;
+
 private:
   std::map<int, std::wstring> m_texts;
 };
@@ -60,6 +60,9 @@ public:
   [[nodiscard]] const glm::ivec2 &getWalkSpeed() const;
 
   std::vector<glm::vec2> walkTo(const glm::vec2 &destination, std::optional<Facing> facing = std::nullopt);
+  /// Walks to the destination once the path has been calculated in background.
+  /// The actor is considered as walking while the path is being calculated.
+  void walkToAsync(const glm::vec2 &destination, std::optional<Facing> facing = std::nullopt);
   void stopWalking();
   [[nodiscard]] bool isWalking() const;
   std::unique_ptr<PathDrawable> getPath();
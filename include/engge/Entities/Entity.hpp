@@ -98,6 +98,12 @@ public:
 
   virtual HSQOBJECT &getTable() = 0;
   [[nodiscard]] virtual HSQOBJECT &getTable() const = 0;
+  /// Indicates that the table has been modified without the entity setters, the visibility,
+  /// the touchability and the color of the entity will be read again from the table.
+  ///
+  /// These properties are also read again once per frame, so a script assigning `_hidden`,
+  /// `_touchable` or `_color` directly is seen from the next frame.
+  void invalidateProperties();
 
   [[nodiscard]] bool hasParent() const;
   void setParent(Entity *pParent);
@@ -128,6 +134,8 @@ private:
 
 protected:
   [[nodiscard]] std::vector<Entity *> getChildren() const;
+  /// Called when the position, the offset, the rotation or the scale of the entity changes.
+  virtual void onTransformChanged();
 
 private:
   struct Impl;
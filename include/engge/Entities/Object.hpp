@@ -127,6 +127,9 @@ public:
   [[nodiscard]] int getPop() const;
   [[nodiscard]] float getPopScale() const;
 
+protected:
+  void onTransformChanged() override;
+
 private:
   void draw(ngf::RenderTarget &target, ngf::RenderStates states) const override;
 
@@ -2,6 +2,7 @@
 #include <ngf/Graphics/Color.h>
 #include <ngf/Graphics/RenderTarget.h>
 #include <ngf/Graphics/RenderStates.h>
+#include <engge/Graphics/SpriteBatch.hpp>
 
 namespace ng {
 struct Animation;
@@ -24,5 +25,6 @@ private:
   const Animation *m_anim{nullptr};
   bool m_flipX{false};
   ngf::Color m_color{ngf::Colors::White};
+  mutable SpriteBatch m_batch;
 };
 }
\ No newline at end of file
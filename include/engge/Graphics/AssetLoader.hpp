@@ -0,0 +1,41 @@
+#pragma once
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <engge/System/NonCopyable.hpp>
+
+namespace ng {
+/// Pool of worker threads running CPU jobs in background, such as reading and
+/// decoding assets or calculating walk paths.
+///
+/// Jobs must not touch the GPU nor the logger, they only work on CPU memory
+/// which is owned by the job or protected by a lock.
+class AssetLoader : public NonCopyable {
+public:
+  explicit AssetLoader(std::size_t numWorkers = getDefaultWorkerCount());
+  ~AssetLoader();
+
+  /// Queues a job and returns a future which is ready when the job is done.
+  /// If the job throws, the exception is rethrown by the future.
+  std::shared_future<void> enqueue(std::function<void()> job);
+
+  [[nodiscard]] std::size_t getWorkerCount() const { return m_workers.size(); }
+  [[nodiscard]] std::size_t getPendingJobCount() const;
+
+  static std::size_t getDefaultWorkerCount();
+
+private:
+  void run();
+
+private:
+  std::vector<std::thread> m_workers;
+  std::deque<std::packaged_task<void()>> m_jobs;
+  mutable std::mutex m_mutex;
+  std::condition_variable m_condition;
+  bool m_isStopping{false};
+};
+} // namespace ng
@@ -11,6 +11,8 @@ public:
   void setTextureManager(ResourceManager *textureManager);
 
   void load(const std::string &path);
+  /// Loads the font from its already parsed JSON description.
+  void load(const std::string &path, ngf::GGPackValue json);
 
   [[nodiscard]] const std::shared_ptr<ngf::Texture> &getTexture(unsigned int) const override;
   [[nodiscard]] const ngf::Glyph &getGlyph(unsigned int codePoint) const override;
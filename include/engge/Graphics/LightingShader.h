@@ -1,6 +1,9 @@
 #pragma once
 #include <array>
+#include <optional>
+#include <vector>
 #include <ngf/Graphics/Color.h>
+#include <ngf/Graphics/Rect.h>
 #include <ngf/Graphics/Shader.h>
 #include <ngf/Graphics/Texture.h>
 #include <engge/Engine/Light.hpp>
@@ -26,9 +29,47 @@ public:
   [[nodiscard]] int getNumberLights() const;
 
   void setLights(const std::array<Light, MaxLights> &lights);
+  /// Only uses the lights which can reach the given bounds (in the lights coordinates)
+  /// for the next sprites, until the next call to `cullLights` or `setLights`.
+  void cullLights(const ngf::frect &bounds);
+
+private:
+  /// Light as it is sent to the shader.
+  struct LightData {
+    glm::vec3 pos;
+    glm::vec2 coneDirection;
+    float coneCosineHalfConeAngle;
+    float coneFalloff;
+    glm::vec3 color;
+    float brightness;
+    float cutoffRadius;
+    float halfRadius;
+  };
+
+  template<typename T>
+  static bool update(std::optional<T> &cachedValue, const T &value);
+  void uploadLights(const std::array<int, MaxLights> &indices, int count);
 
 private:
   int m_numberLights{0};
   ngf::Color m_ambient{ngf::Colors::White};
+  /// Lights which are on, the vector keeps its capacity between frames.
+  std::vector<LightData> m_lights;
+
+  // the last uploaded values: a uniform is uploaded only when its value changes
+  std::optional<glm::vec2> m_contentSize;
+  std::optional<glm::vec2> m_spritePosInSheet;
+  std::optional<glm::vec2> m_spriteSizeRelToSheet;
+  std::optional<glm::vec2> m_spriteOffset;
+  std::optional<glm::vec3> m_ambientColor;
+  std::optional<int> m_numberLightsUniform;
+  std::optional<std::array<glm::vec3, MaxLights>> m_lightPos;
+  std::optional<std::array<glm::vec2, MaxLights>> m_lightConeDirection;
+  std::optional<std::array<float, MaxLights>> m_lightConeCosineHalfConeAngle;
+  std::optional<std::array<float, MaxLights>> m_lightConeFalloff;
+  std::optional<std::array<glm::vec3, MaxLights>> m_lightColor;
+  std::optional<std::array<float, MaxLights>> m_lightBrightness;
+  std::optional<std::array<float, MaxLights>> m_lightCutoffRadius;
+  std::optional<std::array<float, MaxLights>> m_lightHalfRadius;
 };
 }
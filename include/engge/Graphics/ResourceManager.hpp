@@ -1,8 +1,12 @@
 #pragma once
+#include <future>
 #include <map>
 #include <memory>
+#include <engge/Graphics/AssetLoader.hpp>
 #include <engge/System/NonCopyable.hpp>
+#include <ngf/Graphics/Image.h>
 #include <ngf/Graphics/Texture.h>
+#include <ngf/IO/GGPackValue.h>
 
 namespace ngf {
 class FntFont;
@@ -14,7 +18,22 @@ class SpriteSheet;
 
 struct TextureResource {
   std::shared_ptr<ngf::Texture> texture;
-  size_t size;
+  size_t size;                 ///< size of the texture in GPU memory
+  size_t lastUsedFrame{0};
+};
+
+struct SpriteSheetResource {
+  std::shared_ptr<SpriteSheet> spriteSheet;
+  size_t size;                 ///< estimated size of the sprite sheet in memory
+  size_t lastUsedFrame{0};
+};
+
+struct ResourceStats {
+  size_t textureBytes{0};
+  size_t spriteSheetBytes{0};
+  size_t hits{0};
+  size_t misses{0};
+  size_t evictions{0};
 };
 
 class ResourceManager : public NonCopyable {
@@ -27,18 +46,74 @@ public:
   ngf::FntFont &getFntFont(const std::string &id);
   const SpriteSheet &getSpriteSheet(const std::string &id);
 
+  /// Starts to read and to decode a texture in background.
+  /// The future is ready once the image is decoded, the GPU upload is done
+  /// by `update` or by the next call to `getTexture`.
+  std::shared_future<void> loadTextureAsync(const std::string &id);
+  /// Starts to parse a sprite sheet and to decode its texture in background.
+  std::shared_future<void> loadSpriteSheetAsync(const std::string &id);
+  /// Starts to parse a font and to decode its texture in background.
+  std::shared_future<void> loadFontAsync(const std::string &id);
+
+  /// Finishes the background loads which are ready and releases the least recently used
+  /// resources when the memory budget is exceeded, this has to be called from the main thread.
+  void update();
+
+  /// Sets the maximum memory used by the textures and by the sprite sheets.
+  /// Resources still referenced or used during the last frames are never released.
+  void setMemoryBudget(size_t textureBytes, size_t spriteSheetBytes);
+  [[nodiscard]] size_t getTextureBudget() const { return m_textureBudget; }
+  [[nodiscard]] size_t getSpriteSheetBudget() const { return m_spriteSheetBudget; }
+  [[nodiscard]] const ResourceStats &getStats() const { return m_stats; }
+
   [[nodiscard]] const std::map<std::string, TextureResource> &getTextureMap() const { return m_textureMap; }
+  [[nodiscard]] std::size_t getPendingLoadCount() const;
 
 private:
+  struct DecodedTexture {
+    ngf::Image image;
+    size_t size{0};
+    bool isValid{false};
+  };
+
+  template<typename TData>
+  struct PendingLoad {
+    std::shared_future<void> future;
+    std::shared_ptr<TData> data;
+  };
+
   void load(const std::string &id);
   void loadFont(const std::string &id);
   void loadFntFont(const std::string &id);
   void loadSpriteSheet(const std::string &id);
 
+  void addTexture(const std::string &id, const ngf::Image &image);
+  void addSpriteSheet(const std::string &id, std::shared_ptr<SpriteSheet> spriteSheet);
+  void evictTextures();
+  void evictSpriteSheets();
+  void readMemoryBudget();
+
+  void finishTexture(const std::string &id, PendingLoad<DecodedTexture> pending);
+  void finishFont(const std::string &id, PendingLoad<ngf::GGPackValue> pending);
+  void finishSpriteSheet(const std::string &id, PendingLoad<SpriteSheet> pending);
+
+  static std::shared_future<void> makeReadyFuture();
+
 private:
+  /// Number of frames a resource has to stay unused before it can be released.
+  static const size_t EvictionDelayInFrames = 120;
+
   std::map<std::string, TextureResource> m_textureMap;
   std::map<std::string, std::shared_ptr<GGFont>> m_fontMap;
   std::map<std::string, std::shared_ptr<ngf::FntFont>> m_fntFontMap;
-  std::map<std::string, std::shared_ptr<SpriteSheet>> m_spriteSheetMap;
+  std::map<std::string, SpriteSheetResource> m_spriteSheetMap;
+  std::map<std::string, PendingLoad<DecodedTexture>> m_pendingTextures;
+  std::map<std::string, PendingLoad<ngf::GGPackValue>> m_pendingFonts;
+  std::map<std::string, PendingLoad<SpriteSheet>> m_pendingSpriteSheets;
+  size_t m_textureBudget{0};
+  size_t m_spriteSheetBudget{0};
+  size_t m_frame{0};
+  ResourceStats m_stats;
+  AssetLoader m_loader;
 };
-} // namespace ng
\ No newline at end of file
+} // namespace ng
@@ -0,0 +1,46 @@
+#pragma once
+#include <vector>
+#include <glm/mat3x3.hpp>
+#include <ngf/Graphics/Color.h>
+#include <ngf/Graphics/Rect.h>
+#include <ngf/Graphics/RenderStates.h>
+#include <ngf/Graphics/RenderTarget.h>
+#include <ngf/Graphics/Texture.h>
+#include <ngf/Graphics/Vertex.h>
+
+namespace ng {
+/// @brief Groups the sprites sharing the same texture and shader in a single draw call.
+///
+/// The shader, if any, has to be a LightingShader.
+///
+/// The vertices are transformed on the CPU, so sprites with different transforms can be
+/// drawn together. The per-sprite uniforms of the LightingShader are not set: only the
+/// sprites drawn without lights can be batched, see `canBatch`.
+class SpriteBatch {
+public:
+  /// Indicates whether or not a sprite drawn with these states can be batched.
+  static bool canBatch(const ngf::RenderStates &states);
+
+  /// Adds a sprite to the batch, the pending sprites are drawn first if
+  /// the sprite uses a different texture or shader.
+  void draw(ngf::RenderTarget &target,
+            const ngf::Texture &texture,
+            const ngf::irect &textureRect,
+            ngf::Color color,
+            const ngf::RenderStates &states);
+  /// Draws the pending sprites.
+  void flush(ngf::RenderTarget &target);
+
+  /// Appends the two triangles of a sprite, transformed on the CPU, to a vertex array.
+  static void appendSprite(std::vector<ngf::Vertex> &vertices,
+                           const ngf::Texture &texture,
+                           const ngf::irect &textureRect,
+                           ngf::Color color,
+                           const glm::mat3 &transform);
+
+private:
+  std::vector<ngf::Vertex> m_vertices;
+  const ngf::Texture *m_pTexture{nullptr};
+  ngf::Shader *m_pShader{nullptr};
+};
+} // namespace ng
@@ -17,6 +17,12 @@ public:
   [[nodiscard]] ngf::irect getSpriteSourceSize(const std::string &name) const;
   [[nodiscard]] glm::ivec2 getSourceSize(const std::string &name) const;
   [[nodiscard]] SpriteSheetItem getItem(const std::string &name) const;
+  /// Gets an estimation of the memory used by the frames of this sprite sheet in bytes.
+  [[nodiscard]] size_t getMemorySize() const;
+
+private:
+  bool loadFromCache(const std::string &entry);
+  void saveToCache(const std::string &entry) const;
 
 private:
   ResourceManager *m_pResourceManager{nullptr};
@@ -1,4 +1,7 @@
 #pragma once
+#include <optional>
+#include <string>
+#include <ngf/Graphics/Color.h>
 #include <ngf/Graphics/Text.h>
 
 namespace ng {
@@ -8,5 +11,21 @@ public:
   Text();
   /// @brief Creates a text from a string, font and size.
   Text(std::wstring string, const ngf::Font &font, unsigned int characterSize);
+
+  /// @brief Sets the string, the font and the maximum width of the text.
+  ///
+  /// The glyphs are laid out again only when one of them has changed since the last call,
+  /// this allows to keep a text drawn every frame without computing its layout every frame.
+  /// The text bounds are shown or hidden according to the current debug option.
+  void setLayout(const std::wstring &string, const ngf::Font &font, int maxWidth = 0);
+  /// @brief Sets the color of the text if it is different from the current one.
+  void updateColor(const ngf::Color &color);
+
+private:
+  std::wstring m_layoutString;
+  const ngf::Font *m_pLayoutFont{nullptr};
+  int m_layoutMaxWidth{0};
+  std::optional<ngf::Color> m_color;
+  bool m_showTextBounds{false};
 };
-}
\ No newline at end of file
+}
@@ -9,6 +9,7 @@ public:
   explicit GGPackBufferStream(std::vector<char> input);
 
   void setBuffer(const std::vector<char> &input);
+  void setBuffer(std::vector<char> &&input);
   void read(char *data, size_t size) override;
   void seek(int pos) override;
   [[nodiscard]] int getLength() const override;
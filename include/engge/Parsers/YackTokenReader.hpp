@@ -1,10 +1,10 @@
 #pragma once
-#include <string>
+#include <cstddef>
 #include <iostream>
-#include <fstream>
-#include <map>
+#include <iterator>
+#include <string>
+#include <string_view>
 #include <vector>
-#include "GGPackBufferStream.hpp"
 
 namespace ng {
 enum class TokenId {
@@ -26,9 +26,10 @@ enum class TokenId {
 };
 
 struct Token {
-  TokenId id;
-  std::streampos start;
-  std::streampos end;
+  TokenId id{TokenId::None};
+  std::size_t start{0};
+  std::size_t end{0};
+  int line{0};
 
   friend std::ostream &operator<<(std::ostream &os, const Token &obj);
 
@@ -36,32 +37,33 @@ private:
   [[nodiscard]] std::string readToken() const;
 };
 
+/// @brief Reads the tokens of a yack dialog.
+///
+/// The whole buffer is tokenized once when it is loaded, whitespaces, comments and new lines
+/// are skipped and the remaining tokens are kept in a flat array ending with an End token.
 class YackTokenReader {
 public:
   class Iterator {
   public:
     using value_type = Token;
     using difference_type = ptrdiff_t;
-    using pointer = Token *;
-    using reference = Token &;
+    using pointer = const Token *;
+    using reference = const Token &;
     using iterator_category = std::forward_iterator_tag;
 
   private:
-    YackTokenReader &m_reader;
-    std::streampos m_pos;
-    Token m_token;
+    const YackTokenReader *m_pReader{nullptr};
+    std::size_t m_index{0};
 
   public:
-    Iterator(YackTokenReader &reader, std::streampos pos);
-    Iterator(const Iterator &it);
+    Iterator(const YackTokenReader &reader, std::size_t index);
     Iterator &operator++();
     Iterator operator++(int);
 
-    bool operator==(const Iterator &rhs) const { return m_pos == rhs.m_pos; }
-    bool operator!=(const Iterator &rhs) const { return m_pos != rhs.m_pos; }
-    Token &operator*();
+    bool operator==(const Iterator &rhs) const { return m_index == rhs.m_index; }
+    bool operator!=(const Iterator &rhs) const { return m_index != rhs.m_index; }
     const Token &operator*() const;
-    Token *operator->();
+    const Token *operator->() const;
   };
 
   using iterator = Iterator;
@@ -70,26 +72,30 @@ public:
   YackTokenReader();
 
   void load(const std::string &path);
-  iterator begin();
-  iterator end();
-  bool readToken(Token &token);
-  std::string readText(std::streampos pos, std::streamsize size);
-  std::string readText(const Token &token);
-  int getLine(const Token &token) const;
+  [[nodiscard]] iterator begin() const;
+  [[nodiscard]] iterator end() const;
+  /// @brief Gets the text of a token without copying it, it is valid as long as this reader.
+  [[nodiscard]] std::string_view getText(const Token &token) const;
+  [[nodiscard]] std::string readText(const Token &token) const;
+  [[nodiscard]] int getLine(const Token &token) const;
+  /// @brief Gets the line (starting from 1) containing the character at the specified offset.
+  [[nodiscard]] int getLine(std::size_t offset) const;
 
 private:
-  TokenId readTokenId();
-  TokenId readCode();
-  TokenId readCondition();
-  TokenId readDollar();
-  TokenId readNumber();
-  TokenId readComment();
-  TokenId readString();
-  TokenId readIdentifier(char c);
+  void tokenize();
+  TokenId readTokenId(std::size_t &pos);
+  [[nodiscard]] std::size_t readCode(std::size_t pos) const;
+  [[nodiscard]] std::size_t readCondition(std::size_t pos) const;
+  [[nodiscard]] std::size_t readDollar(std::size_t pos) const;
+  [[nodiscard]] std::size_t readNumber(std::size_t pos) const;
+  [[nodiscard]] std::size_t readComment(std::size_t pos) const;
+  [[nodiscard]] std::size_t readString(std::size_t pos) const;
+  [[nodiscard]] char peek(std::size_t pos) const;
 
 private:
-  GGPackBufferStream m_stream;
-  std::map<int, int> m_lines;
-  int m_offset;
+  std::vector<char> m_buffer;
+  std::vector<Token> m_tokens;
+  /// Offsets of the new lines, in increasing order.
+  std::vector<std::size_t> m_lines;
 };
 } // namespace ng
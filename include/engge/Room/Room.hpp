@@ -1,4 +1,5 @@
 #pragma once
+#include <future>
 #include <vector>
 #include <engge/Graphics/SpriteSheet.hpp>
 #include <squirrel.h>
@@ -46,8 +47,14 @@ public:
   [[nodiscard]] std::string getName() const;
 
   void load(const char *name);
+  /// Starts to load in background the textures used by the room and its objects.
+  void prefetch();
   std::vector<std::unique_ptr<Object>> &getObjects();
   [[nodiscard]] const std::vector<std::unique_ptr<Object>> &getObjects() const;
+  /// Gets the objects whose real hotspot contains the given position, in the same order as getObjects.
+  void getObjectsAt(glm::ivec2 pos, std::vector<Object *> &objects) const;
+  /// Indicates that the real hotspot of an object of this room has changed.
+  void invalidateHotspot(const Object &object);
   [[nodiscard]] std::array<Light, LightingShader::MaxLights> &getLights();
   [[nodiscard]] int getNumberLights() const;
   LightingShader& getLightingShader();
@@ -59,6 +66,8 @@ public:
   void setWalkboxEnabled(const std::string &name, bool isEnabled);
   [[nodiscard]] const ngf::Walkbox *getWalkbox(const std::string &name) const;
   [[nodiscard]] std::vector<glm::vec2> calculatePath(glm::vec2 start, glm::vec2 end) const;
+  /// Queues the calculation of a path in background, the result can be retrieved on a later frame.
+  [[nodiscard]] std::shared_future<std::vector<glm::vec2>> calculatePathAsync(glm::vec2 start, glm::vec2 end) const;
   std::vector<ngf::Walkbox> &getWalkboxes();
   std::vector<ngf::Walkbox> &getGraphWalkboxes();
   [[nodiscard]] const ngf::Graph *getGraph() const;
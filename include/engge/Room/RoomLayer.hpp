@@ -2,6 +2,7 @@
 #include <vector>
 #include <ngf/Graphics/Texture.h>
 #include <engge/Entities/Entity.hpp>
+#include <engge/Graphics/SpriteBatch.hpp>
 #include <engge/Graphics/SpriteSheetItem.h>
 
 namespace ng {
@@ -33,10 +34,23 @@ public:
   void drawForeground(ngf::RenderTarget &target, ngf::RenderStates states) const;
   void update(const ngf::TimeSpan &elapsed);
 
+private:
+  /// An entity in the render list with the z-order used to sort it.
+  struct RenderItem {
+    Entity *pEntity{nullptr};
+    int zorder{0};
+  };
+
+  void updateRenderList() const;
+
 private:
   std::string m_textureName;
   std::vector<SpriteSheetItem> m_backgrounds;
   std::vector<std::reference_wrapper<Entity>> m_entities;
+  /// Entities sorted by z-order, kept between frames because it is nearly sorted.
+  mutable std::vector<RenderItem> m_renderList;
+  mutable bool m_isRenderListDirty{false};
+  mutable SpriteBatch m_batch;
   glm::vec2 m_parallax{1, 1};
   int m_zsort{0};
   bool m_enabled{true};
@@ -107,6 +107,9 @@ public:
   static void printfunc(HSQUIRRELVM v, const SQChar *s, ...);
 
 private:
+  /// Pushes the closure of a script: a local .nut file, the bytecode cached during
+  /// a previous run or the .bnut entry of the packs.
+  static bool compileNutScript(const std::string &name);
   static SQInteger aux_printerror(HSQUIRRELVM v);
   static void errorHandler(HSQUIRRELVM v, const SQChar *desc,
                            const SQChar *source, SQInteger line,
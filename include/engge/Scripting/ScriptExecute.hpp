@@ -1,4 +1,5 @@
 #pragma once
+#include <functional>
 #include <string>
 
 namespace ng {
@@ -9,6 +10,8 @@ public:
   virtual void execute(const std::string &code) = 0;
   virtual std::string executeDollar(const std::string &code) = 0;
   virtual bool executeCondition(const std::string &code) = 0;
+  /// Compiles a condition once, the returned predicate evaluates it each time it is called.
+  virtual std::function<bool()> compileCondition(const std::string &code) = 0;
   virtual SoundDefinition *getSoundDefinition(const std::string &name) = 0;
 };
 }
\ No newline at end of file
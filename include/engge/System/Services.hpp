@@ -1,6 +1,8 @@
 #pragma once
 #include <Engine/AchievementManager.hpp>
 #include "engge/Audio/SoundManager.hpp"
+#include "engge/Engine/AssetCache.hpp"
+#include "engge/Dialog/DialogCache.hpp"
 #include "engge/Input/CommandManager.hpp"
 #include "engge/Engine/EngineSettings.hpp"
 #include "engge/Engine/EntityManager.hpp"
@@ -21,6 +23,8 @@ public:
     ng::Locator<ng::AchievementManager>::create();
     ng::Locator<ng::Preferences>::create();
     ng::Locator<ng::EngineSettings>::create().loadPacks();
+    ng::Locator<ng::AssetCache>::create();
+    ng::Locator<ng::DialogCache>::create();
     ng::Locator<ng::EntityManager>::create();
     ng::Locator<ng::SoundManager>::create();
     ng::Locator<ng::TextDatabase>::create();
@@ -18,7 +18,7 @@ SoundDefinition::~SoundDefinition() = default;
 void SoundDefinition::load() {
   if (m_isLoaded)
     return;
-  auto buffer = Locator<EngineSettings>::get().readBuffer(m_path);
+  auto buffer = Locator<EngineSettings>::get().readView(m_path);
   m_buffer.loadFromMemory(buffer.data(), buffer.size());
   m_isLoaded = true;
 }
@@ -9,6 +9,7 @@
 #include <engge/Audio/SoundDefinition.hpp>
 #include <engge/Audio/SoundId.hpp>
 #include <engge/Audio/SoundManager.hpp>
+#include <engge/Engine/EntityManager.hpp>
 
 namespace ng {
 SoundManager::SoundManager() = default;
@@ -25,6 +26,7 @@ std::shared_ptr<SoundDefinition> SoundManager::defineSound(const std::string &na
 
   auto sound = std::make_shared<SoundDefinition>(name);
   m_sounds.push_back(sound);
+  Locator<EntityManager>::get().addSound(sound);
   return sound;
 }
 
@@ -57,6 +59,7 @@ std::shared_ptr<SoundId> SoundManager::play(std::shared_ptr<SoundDefinition> sou
   auto
       sound = m_pEngine->getApplication()->getAudioSystem().playSound(soundDefinition->m_buffer, loopTimes, fadeInTime);
   auto soundId = std::make_shared<SoundId>(*this, soundDefinition, sound, category, id);
+  Locator<EntityManager>::get().addSound(soundId);
   auto index = sound->get().getChannel();
   if (index == -1) {
     error("cannot play sound no more channel available");
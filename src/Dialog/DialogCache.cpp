@@ -0,0 +1,77 @@
+#include <exception>
+#include "engge/Dialog/DialogCache.hpp"
+#include "engge/Engine/EngineSettings.hpp"
+#include "engge/Engine/Preferences.hpp"
+#include "engge/System/Locator.hpp"
+#include "engge/System/Logger.hpp"
+#include "../Util/Util.hpp"
+
+namespace ng {
+namespace {
+const std::string DialogExtension = ".BYACK";
+}
+
+std::optional<size_t> CompiledDialog::findLabel(const std::string &name) const {
+  auto it = labels.find(name);
+  if (it == labels.end())
+    return std::nullopt;
+  return it->second;
+}
+
+DialogCache::DialogCache() {
+  if (Locator<Preferences>::get().getUserPreference(PreferenceNames::EnggeDialogWarmUp,
+                                                    PreferenceDefaultValues::EnggeDialogWarmUp)) {
+    warmUp();
+  }
+}
+
+std::shared_ptr<const CompiledDialog> DialogCache::get(const std::string &name) {
+  auto key = str_toupper(name);
+  auto it = m_dialogs.find(key);
+  if (it != m_dialogs.end())
+    return it->second;
+
+  auto pDialog = compile(name);
+  m_dialogs.emplace(std::move(key), pDialog);
+  return pDialog;
+}
+
+void DialogCache::warmUp() {
+  for (const auto &pack : Locator<EngineSettings>::get()) {
+    for (const auto &itEntry : *pack) {
+      auto entry = str_toupper(itEntry.first);
+      if (!endsWith(entry, DialogExtension))
+        continue;
+      // a dialog which can't be parsed must not prevent the game to start
+      auto name = itEntry.first.substr(0, itEntry.first.length() - DialogExtension.length());
+      try {
+        get(name);
+      } catch (const std::exception &e) {
+        error("Failed to compile dialog {}: {}", name, e.what());
+      }
+    }
+  }
+  info("{} dialogs compiled", m_dialogs.size());
+}
+
+void DialogCache::clear() {
+  m_dialogs.clear();
+}
+
+std::shared_ptr<const CompiledDialog> DialogCache::compile(const std::string &name) {
+  std::string path;
+  path.append(name).append(".byack");
+
+  YackTokenReader reader;
+  reader.load(path);
+  YackParser parser(reader);
+
+  auto pDialog = std::make_shared<CompiledDialog>();
+  pDialog->pCompilationUnit = parser.parse();
+  const auto &labels = pDialog->pCompilationUnit->labels;
+  for (size_t i = 0; i < labels.size(); ++i) {
+    pDialog->labels[labels[i]->name] = i;
+  }
+  return pDialog;
+}
+} // namespace ng
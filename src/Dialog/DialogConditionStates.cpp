@@ -0,0 +1,71 @@
+#include "engge/Dialog/DialogConditionStates.hpp"
+
+namespace ng {
+size_t DialogConditionStates::KeyHash::operator()(const Key &key) const {
+  auto names = (static_cast<uint64_t>(key.dialog) << 32) | key.actor;
+  auto line = (static_cast<uint64_t>(static_cast<uint32_t>(key.line)) << 3) | static_cast<uint64_t>(key.mode);
+  return std::hash<uint64_t>()(names ^ (line * 0x9E3779B97F4A7C15ull));
+}
+
+void DialogConditionStates::add(const DialogConditionState &state) {
+  Key key{state.mode, intern(state.dialog), state.line, intern(state.actorKey)};
+  if (!m_states.insert(key).second)
+    return;
+  key.actor = AnyActor;
+  m_actorCounts[key]++;
+}
+
+bool DialogConditionStates::contains(DialogConditionMode mode,
+                                     const std::string &dialog,
+                                     int32_t line,
+                                     const std::string &actor) const {
+  Key key{mode, 0, line, 0};
+  if (!find(dialog, key.dialog) || !find(actor, key.actor))
+    return false;
+  return m_states.find(key) != m_states.end();
+}
+
+bool DialogConditionStates::contains(DialogConditionMode mode, const std::string &dialog, int32_t line) const {
+  Key key{mode, 0, line, AnyActor};
+  if (!find(dialog, key.dialog))
+    return false;
+  return m_actorCounts.find(key) != m_actorCounts.end();
+}
+
+void DialogConditionStates::remove(DialogConditionMode mode) {
+  for (auto it = m_states.begin(); it != m_states.end();) {
+    if (it->mode != mode) {
+      ++it;
+      continue;
+    }
+    auto key = *it;
+    key.actor = AnyActor;
+    auto itCount = m_actorCounts.find(key);
+    if (--itCount->second == 0) {
+      m_actorCounts.erase(itCount);
+    }
+    it = m_states.erase(it);
+  }
+}
+
+void DialogConditionStates::clear() {
+  m_states.clear();
+  m_actorCounts.clear();
+}
+
+uint32_t DialogConditionStates::intern(const std::string &name) {
+  auto [it, inserted] = m_ids.emplace(name, static_cast<uint32_t>(m_names.size()));
+  if (inserted) {
+    m_names.push_back(name);
+  }
+  return it->second;
+}
+
+bool DialogConditionStates::find(const std::string &name, uint32_t &id) const {
+  auto it = m_ids.find(name);
+  if (it == m_ids.end())
+    return false;
+  id = it->second;
+  return true;
+}
+} // namespace ng
@@ -47,35 +47,26 @@ void DialogManager::draw(ngf::RenderTarget &target, ngf::RenderStates) const {
   const auto view = target.getView();
   target.setView(ngf::View(ngf::frect::fromPositionSize({0, 0}, {Screen::Width, Screen::Height})));
 
-  auto retroFonts = m_pEngine->getPreferences().getUserPreference(PreferenceNames::RetroFonts,
-                                                                  PreferenceDefaultValues::RetroFonts);
-  const GGFont &font = m_pEngine->getResourceManager().getFont(retroFonts ? "FontRetroSheet" : "FontModernSheet");
-
+  const auto &font = getFont();
   auto y = DialogTop;
 
   auto actorName = m_pPlayer->getActor();
   auto dialogHighlight = m_pEngine->getVerbUiColors(actorName)->dialogHighlight;
   auto dialogNormal = m_pEngine->getVerbUiColors(actorName)->dialogNormal;
 
-  ng::Text text;
-  text.setFont(font);
   auto hoverDone = false;
   for (const auto &slot : m_slots) {
     if (!slot.pChoice)
       continue;
 
-    std::wstring s;
-    s = Bullet;
-    s += slot.text;
-    text.setWideString(s);
-    text.getTransform().setPosition({slot.pos.x, y + slot.pos.y});
-    auto bounds = getGlobalBounds(text);
+    getSlotLabel(slot, font, y);
+    auto bounds = getGlobalBounds(slot.label);
     auto hover = bounds.contains(m_mousePos);
-    text.setColor(hover && !hoverDone ? dialogHighlight : dialogNormal);
+    slot.label.updateColor(hover && !hoverDone ? dialogHighlight : dialogNormal);
     hoverDone |= hover;
-    text.draw(target, {});
+    slot.label.draw(target, {});
 
-    y += (2.f * getGlobalBounds(text).getHeight() / 3.f);
+    y += (2.f * bounds.getHeight() / 3.f);
   }
 
   target.setView(view);
@@ -108,7 +99,7 @@ void DialogManager::updateDialogSlots() {
       if (std::regex_search(dialogText, matches, re)) {
         dialogText = matches.suffix();
       }
-      m_slots[i].text = dialogText;
+      m_slots[i].text = Bullet + dialogText;
       m_slots[i].pos = {0, 0};
     }
     m_slots[i].pChoice = pStatement;
@@ -120,25 +111,14 @@ void DialogManager::updateChoices(const ngf::TimeSpan &elapsed) {
   if (m_state != DialogManagerState::WaitingForChoice)
     return;
 
-  auto retroFonts = m_pEngine->getPreferences().getUserPreference(PreferenceNames::RetroFonts,
-                                                                  PreferenceDefaultValues::RetroFonts);
-  const GGFont &font = m_pEngine->getResourceManager().getFont(retroFonts ? "FontRetroSheet" : "FontModernSheet");
-
+  const auto &font = getFont();
   auto y = DialogTop;
   int dialog = 0;
   for (const auto &dlg : m_slots) {
     if (dlg.pChoice == nullptr)
       continue;
 
-    // HACK: bad, bad, this code is the same as in the draw function
-    std::wstring s;
-    s = Bullet;
-    s += dlg.text;
-    ng::Text text;
-    text.setFont(font);
-    text.getTransform().setPosition({dlg.pos.x, dlg.pos.y + y});
-    text.setWideString(s);
-    auto bounds = getGlobalBounds(text);
+    auto bounds = getGlobalBounds(getSlotLabel(dlg, font, y));
     if (bounds.getWidth() > Screen::Width) {
       if (bounds.contains(m_mousePos)) {
         if ((bounds.getWidth() + dlg.pos.x) > Screen::Width) {
@@ -170,23 +150,28 @@ void DialogManager::updateChoices(const ngf::TimeSpan &elapsed) {
     if (!slot.pChoice)
       continue;
 
-    // HACK: bad, bad, this code is the same as in the draw function
-    std::wstring s;
-    s = Bullet;
-    s += slot.text;
-    ng::Text text;
-    text.setFont(font);
-    text.getTransform().setPosition({slot.pos.x, slot.pos.y + y});
-    text.setWideString(s);
-    if (getGlobalBounds(text).contains(m_mousePos)) {
+    auto bounds = getGlobalBounds(getSlotLabel(slot, font, y));
+    if (bounds.contains(m_mousePos)) {
       choose(dialog + 1);
       break;
     }
-    y += getGlobalBounds(text).getHeight() / 2.f;
+    y += bounds.getHeight() / 2.f;
     dialog++;
   }
 }
 
+const GGFont &DialogManager::getFont() const {
+  auto retroFonts = m_pEngine->getPreferences().getUserPreference(PreferenceNames::RetroFonts,
+                                                                  PreferenceDefaultValues::RetroFonts);
+  return m_pEngine->getResourceManager().getFont(retroFonts ? "FontRetroSheet" : "FontModernSheet");
+}
+
+const ng::Text &DialogManager::getSlotLabel(const DialogSlot &slot, const GGFont &font, float y) const {
+  slot.label.setLayout(slot.text, font);
+  slot.label.getTransform().setPosition({slot.pos.x, slot.pos.y + y});
+  return slot.label;
+}
+
 void DialogManager::choose(int choice) {
   if ((choice < 1) || (choice > static_cast<int>(m_slots.size())))
     return;
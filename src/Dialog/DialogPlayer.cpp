@@ -4,6 +4,7 @@
 #include "engge/Dialog/ExpressionVisitor.hpp"
 #include "engge/Dialog/DialogPlayer.hpp"
 #include "engge/Dialog/DialogScriptAbstract.hpp"
+#include "engge/System/Locator.hpp"
 
 namespace ng {
 
@@ -76,13 +77,7 @@ void DialogPlayer::start(const std::string &actor, const std::string &name, cons
   resetState();
   m_actor = actor;
   m_dialogName = name;
-  std::string path;
-  path.append(name).append(".byack");
-
-  YackTokenReader reader;
-  reader.load(path);
-  YackParser parser(reader);
-  m_pCompilationUnit = parser.parse();
+  m_pDialog = Locator<DialogCache>::get().get(name);
   selectLabel(node);
 }
 
@@ -101,7 +96,7 @@ void DialogPlayer::choose(int choiceId) {
         cond->accept(visitor);
         auto state = visitor.getState();
         if (state.has_value()) {
-          m_states.push_back(state.value());
+          m_states.add(state.value());
         }
       }
 
@@ -197,19 +192,14 @@ void DialogPlayer::resetState() {
   m_parrot = true;
   m_limit = 6;
   m_overrideLabel.clear();
-  m_states.erase(std::remove_if(m_states.begin(), m_states.end(), [](const auto &state) {
-    return state.mode == DialogConditionMode::TempOnce;
-  }), m_states.end());
+  m_states.remove(DialogConditionMode::TempOnce);
 }
 
 void DialogPlayer::selectLabel(const std::string &name) {
   trace("select label {}", name);
-  auto it = std::find_if(m_pCompilationUnit->labels.rbegin(),
-                         m_pCompilationUnit->labels.rend(),
-                         [&name](const std::unique_ptr<Ast::Label> &label) {
-                           return label->name == name;
-                         });
-  m_pLabel = it != m_pCompilationUnit->labels.rend() ? it->get() : nullptr;
+  auto index = m_pDialog->findLabel(name);
+  m_pLabel = index ? m_pDialog->pCompilationUnit->labels[*index].get() : nullptr;
+  m_labelIndex = index.value_or(0);
   m_currentStatement = 0;
   clearChoices();
   if (m_pLabel) {
@@ -226,7 +216,7 @@ void DialogPlayer::endDialog() {
 }
 
 bool DialogPlayer::gotoNextLabel() {
-  if (!m_pCompilationUnit) {
+  if (!m_pDialog) {
     endDialog();
     return false;
   }
@@ -234,20 +224,12 @@ bool DialogPlayer::gotoNextLabel() {
     endDialog();
     return false;
   }
-  auto it =
-      std::find_if(m_pCompilationUnit->labels.cbegin(), m_pCompilationUnit->labels.cend(), [this](const auto &pLabel) {
-        return pLabel.get() == m_pLabel;
-      });
-  if (it == m_pCompilationUnit->labels.cend()) {
-    endDialog();
-    return false;
-  }
-  it++;
-  if (it == m_pCompilationUnit->labels.cend()) {
+  const auto &labels = m_pDialog->pCompilationUnit->labels;
+  if (m_labelIndex + 1 >= labels.size()) {
     endDialog();
     return false;
   }
-  selectLabel((*it)->name);
+  selectLabel(labels[m_labelIndex + 1]->name);
   return true;
 }
 
@@ -299,7 +281,7 @@ bool DialogPlayer::acceptConditions(const Ast::Statement *pStatement) {
     cond->accept(stateVisitor);
     auto state = stateVisitor.getState();
     if (state.has_value()) {
-      m_states.push_back(state.value());
+      m_states.add(state.value());
     }
   }
 
@@ -322,50 +304,19 @@ std::function<bool()> DialogPlayer::waitFor(const std::string &actor) { return _
 std::function<bool()> DialogPlayer::waitWhile(const std::string &condition) { return _script.waitWhile(condition); }
 
 bool DialogPlayer::isOnce(int32_t line) const {
-  auto it =
-      std::find_if(m_states.cbegin(), m_states.cend(),
-                   [this, line](const auto &state) {
-                     return state.mode == DialogConditionMode::Once &&
-                         state.actorKey == m_actor &&
-                         state.dialog == m_dialogName &&
-                         state.line == line;
-                   });
-  return it == m_states.cend();
+  return !m_states.contains(DialogConditionMode::Once, m_dialogName, line, m_actor);
 }
 
 bool DialogPlayer::isShowOnce(int32_t line) const {
-  auto it =
-      std::find_if(m_states.cbegin(), m_states.cend(),
-                   [this, line](const auto &state) {
-                     return state.mode == DialogConditionMode::ShowOnce &&
-                         state.actorKey == m_actor &&
-                         state.dialog == m_dialogName &&
-                         state.line == line;
-                   });
-  return it == m_states.cend();
+  return !m_states.contains(DialogConditionMode::ShowOnce, m_dialogName, line, m_actor);
 }
 
 bool DialogPlayer::isOnceEver(int32_t line) const {
-  auto it =
-      std::find_if(m_states.cbegin(), m_states.cend(),
-                   [this, line](const auto &state) {
-                     return state.mode == DialogConditionMode::OnceEver &&
-                         state.dialog == m_dialogName &&
-                         state.line == line;
-                   });
-  return it == m_states.cend();
+  return !m_states.contains(DialogConditionMode::OnceEver, m_dialogName, line);
 }
 
 bool DialogPlayer::isTempOnce(int32_t line) const {
-  auto it =
-      std::find_if(m_states.cbegin(), m_states.cend(),
-                   [this, line](const auto &state) {
-                     return state.mode == DialogConditionMode::TempOnce &&
-                         state.actorKey == m_actor &&
-                         state.dialog == m_dialogName &&
-                         state.line == line;
-                   });
-  return it == m_states.cend();
+  return !m_states.contains(DialogConditionMode::TempOnce, m_dialogName, line, m_actor);
 }
 
 bool DialogPlayer::executeCondition(const std::string &condition) const { return _script.executeCondition(condition); }
@@ -53,7 +53,8 @@ std::function<bool()> EngineDialogScript::waitFor(const std::string &actor) {
 }
 std::function<bool()> EngineDialogScript::waitWhile(const std::string &condition) {
   //trace("waitWhile {}", condition);
-  return [*this, condition]() -> bool { return !m_engine.executeCondition(condition); };
+  auto isConditionTrue = m_engine.compileCondition(condition);
+  return [isConditionTrue]() -> bool { return !isConditionTrue(); };
 }
 void EngineDialogScript::execute(const std::string &code) {
   //trace("execute {}", code);
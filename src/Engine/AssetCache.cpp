@@ -0,0 +1,121 @@
+#include <fstream>
+#include <sstream>
+#include <ngf/IO/GGPackHashReader.h>
+#include <ngf/IO/GGPackHashWriter.h>
+#include <ngf/IO/MemoryStream.h>
+#include "engge/Engine/AssetCache.hpp"
+#include "engge/Engine/EngineSettings.hpp"
+#include "engge/Engine/Preferences.hpp"
+#include "engge/System/Locator.hpp"
+#include "engge/System/Logger.hpp"
+
+namespace fs = std::filesystem;
+
+namespace ng {
+namespace {
+constexpr uint32_t CacheMagic = 0x43414745; // "EGAC"
+// increase this version when the binary form of an asset changes
+constexpr uint32_t CacheVersion = 1;
+
+struct CacheHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint64_t stamp;
+  uint64_t size;
+};
+}
+
+AssetCache::AssetCache() {
+  m_path = Locator<EngineSettings>::get().getPath() / "AssetCache";
+  auto &preferences = Locator<Preferences>::get();
+  m_isEnabled = preferences.getUserPreference(PreferenceNames::EnggeAssetCache,
+                                              PreferenceDefaultValues::EnggeAssetCache);
+  preferences.subscribe([this](const std::string &name) {
+    if (name != PreferenceNames::EnggeAssetCache)
+      return;
+    m_isEnabled = Locator<Preferences>::get().getUserPreference(PreferenceNames::EnggeAssetCache,
+                                                                PreferenceDefaultValues::EnggeAssetCache);
+  });
+}
+
+fs::path AssetCache::getFilePath(const std::string &kind, const std::string &entry) const {
+  return m_path / kind / (entry + ".bin");
+}
+
+bool AssetCache::read(const std::string &kind, const std::string &entry, std::vector<char> &data) const {
+  if (!m_isEnabled)
+    return false;
+
+  auto path = getFilePath(kind, entry);
+  std::ifstream is(path, std::ios::binary);
+  if (!is.is_open())
+    return false;
+
+  CacheHeader header{};
+  is.read(reinterpret_cast<char *>(&header), sizeof(header));
+  if (!is || header.magic != CacheMagic || header.version != CacheVersion)
+    return false;
+
+  // the file containing the entry has been modified since the entry has been cached
+  if (header.stamp != Locator<EngineSettings>::get().getEntryStamp(entry))
+    return false;
+
+  // a corrupted or foreign file could request any size
+  std::error_code ec;
+  auto fileSize = fs::file_size(path, ec);
+  if (ec || fileSize < sizeof(header) || header.size != fileSize - sizeof(header))
+    return false;
+
+  data.resize(header.size);
+  is.read(data.data(), header.size);
+  return static_cast<bool>(is);
+}
+
+void AssetCache::write(const std::string &kind, const std::string &entry, const std::vector<char> &data) const {
+  if (!m_isEnabled)
+    return;
+
+  auto path = getFilePath(kind, entry);
+  std::error_code ec;
+  fs::create_directories(path.parent_path(), ec);
+  if (ec)
+    return;
+
+  // write in a temporary file first to never leave a truncated entry in the cache
+  auto tmpPath = path;
+  tmpPath += ".tmp";
+  {
+    std::ofstream os(tmpPath, std::ios::binary);
+    if (!os.is_open())
+      return;
+    CacheHeader header{CacheMagic, CacheVersion, Locator<EngineSettings>::get().getEntryStamp(entry), data.size()};
+    os.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    os.write(data.data(), data.size());
+    if (!os)
+      return;
+  }
+  fs::rename(tmpPath, path, ec);
+}
+
+void AssetCache::clear() {
+  std::error_code ec;
+  fs::remove_all(m_path, ec);
+}
+
+ngf::GGPackValue AssetCache::readHashEntry(const std::string &entry) const {
+  std::vector<char> data;
+  if (read("hash", entry, data)) {
+    ngf::MemoryStream ms(data.data(), data.data() + data.size());
+    return ngf::GGPackHashReader::read(ms);
+  }
+
+  auto hash = Locator<EngineSettings>::get().readEntry(entry);
+  if (m_isEnabled) {
+    std::stringstream s;
+    ngf::GGPackHashWriter::write(hash, s);
+    auto text = s.str();
+    write("hash", entry, std::vector<char>(text.begin(), text.end()));
+  }
+  return hash;
+}
+} // namespace ng
@@ -78,6 +78,7 @@ Engine::Engine() : m_pImpl(std::make_unique<Impl>()) {
   });
 
   m_pImpl->m_preferences.subscribe([this](const std::string &name) {
+    m_pImpl->m_hud.invalidatePreferences();
     if (name == PreferenceNames::Language) {
       auto newLang = m_pImpl->m_preferences.getUserPreference<std::string>(PreferenceNames::Language,
                                                                            PreferenceDefaultValues::Language);
@@ -230,7 +231,10 @@ void Engine::setScriptExecute(std::unique_ptr<ScriptExecute> scriptExecute) {
   m_pImpl->m_pScriptExecute = std::move(scriptExecute);
 }
 
-void Engine::addThread(std::unique_ptr<ThreadBase> thread) { m_pImpl->m_threads.push_back(std::move(thread)); }
+void Engine::addThread(std::unique_ptr<ThreadBase> thread) {
+  Locator<EntityManager>::get().addThread(thread.get());
+  m_pImpl->m_threads.push_back(std::move(thread));
+}
 
 std::vector<std::unique_ptr<ThreadBase>> &Engine::getThreads() { return m_pImpl->m_threads; }
 
@@ -267,6 +271,12 @@ SQInteger Engine::setRoom(Room *pRoom) {
   return 0;
 }
 
+void Engine::prefetchRoom(Room *pRoom) {
+  if (!pRoom || pRoom == m_pImpl->m_pRoom)
+    return;
+  pRoom->prefetch();
+}
+
 SQInteger Engine::enterRoomFromDoor(Object *pDoor) {
   auto dir = pDoor->getUseDirection();
   auto facing = toFacing(dir);
@@ -323,6 +333,7 @@ void Engine::update(const ngf::TimeSpan &el) {
       getPreferences().getUserPreference(PreferenceNames::EnggeGameSpeedFactor,
                                          PreferenceDefaultValues::EnggeGameSpeedFactor);
   const ngf::TimeSpan elapsed(ngf::TimeSpan::seconds(el.getTotalSeconds() * gameSpeedFactor));
+  m_pImpl->m_resourceManager.update();
   m_pImpl->stopThreads();
   auto screenSize = m_pImpl->m_pRoom->getScreenSize();
   auto view = ngf::View{ngf::frect::fromPositionSize({0, 0}, screenSize)};
@@ -511,113 +522,126 @@ void Engine::draw(ngf::RenderTarget &target, bool screenshot) const {
   if (!m_pImpl->m_pRoom)
     return;
 
-  // update room shader if necessary
+  // select the room shader
   ngf::RenderStates states;
   auto effect = m_pImpl->m_pRoom->getEffect();
-  if (m_pImpl->m_roomEffect != effect) {
-    if (effect == RoomEffectConstants::EFFECT_BLACKANDWHITE) {
-      m_pImpl->m_roomShader.load(Shaders::vertexShader, Shaders::bwFragmentShader);
-    } else if (effect == RoomEffectConstants::EFFECT_EGA) {
-      m_pImpl->m_roomShader.load(Shaders::vertexShader, Shaders::egaFragmenShader);
-    } else if (effect == RoomEffectConstants::EFFECT_GHOST) {
-      m_pImpl->m_roomShader.load(Shaders::vertexShader, Shaders::ghostFragmentShader);
-    } else if (effect == RoomEffectConstants::EFFECT_SEPIA) {
-      m_pImpl->m_roomShader.load(Shaders::vertexShader, Shaders::sepiaFragmentShader);
-    } else if (effect == RoomEffectConstants::EFFECT_VHS) {
-      m_pImpl->m_roomShader.load(Shaders::vertexShader, Shaders::vhsFragmentShader);
-    }
-    m_pImpl->m_roomEffect = effect;
+  if (effect < RoomEffectConstants::EFFECT_NONE || effect >= static_cast<int>(m_pImpl->m_roomShaders.size())) {
+    effect = RoomEffectConstants::EFFECT_NONE;
   }
-  states.shader = &m_pImpl->m_roomShader;
+  auto &roomShader = m_pImpl->m_roomShaders[effect];
+  states.shader = &roomShader;
   if (effect == RoomEffectConstants::EFFECT_GHOST) {
     // don't remove the fmod function or you will have float overflow with the shader and the effect will look strange
-    m_pImpl->m_roomShader.setUniform("iGlobalTime", roomEffect.iGlobalTime);
-    m_pImpl->m_roomShader.setUniform("iFade", roomEffect.iFade);
-    m_pImpl->m_roomShader.setUniform("wobbleIntensity", roomEffect.wobbleIntensity);
-    m_pImpl->m_roomShader.setUniform("shadows", roomEffect.shadows);
-    m_pImpl->m_roomShader.setUniform("midtones", roomEffect.midtones);
-    m_pImpl->m_roomShader.setUniform("highlights", roomEffect.highlights);
+    roomShader.setUniform("iGlobalTime", roomEffect.iGlobalTime);
+    roomShader.setUniform("iFade", roomEffect.iFade);
+    roomShader.setUniform("wobbleIntensity", roomEffect.wobbleIntensity);
+    roomShader.setUniform("shadows", roomEffect.shadows);
+    roomShader.setUniform("midtones", roomEffect.midtones);
+    roomShader.setUniform("highlights", roomEffect.highlights);
   } else if (effect == RoomEffectConstants::EFFECT_SEPIA) {
-    m_pImpl->m_roomShader.setUniform("sepiaFlicker", roomEffect.sepiaFlicker);
-    m_pImpl->m_roomShader.setUniformArray("RandomValue", roomEffect.RandomValue.data(), 5);
-    m_pImpl->m_roomShader.setUniform("TimeLapse", roomEffect.TimeLapse);
+    roomShader.setUniform("sepiaFlicker", roomEffect.sepiaFlicker);
+    roomShader.setUniformArray("RandomValue", roomEffect.RandomValue.data(), 5);
+    roomShader.setUniform("TimeLapse", roomEffect.TimeLapse);
   } else if (effect == RoomEffectConstants::EFFECT_VHS) {
-    m_pImpl->m_roomShader.setUniform("iGlobalTime", roomEffect.iGlobalTime);
-    m_pImpl->m_roomShader.setUniform("iNoiseThreshold", roomEffect.iNoiseThreshold);
+    roomShader.setUniform("iGlobalTime", roomEffect.iGlobalTime);
+    roomShader.setUniform("iNoiseThreshold", roomEffect.iNoiseThreshold);
   } else if (effect == RoomEffectConstants::EFFECT_NONE) {
     states.shader = nullptr;
   }
 
-  // render the room to a texture, this allows to create a post process effect: room effect
-  ngf::RenderTexture roomTexture(target.getSize());
   auto screenSize = m_pImpl->m_pRoom->getScreenSize();
   ngf::View view(ngf::frect::fromPositionSize({0, 0}, screenSize));
-  roomTexture.setView(view);
-  roomTexture.clear();
-  m_pImpl->m_pRoom->draw(roomTexture, m_pImpl->m_camera.getRect().getTopLeft());
-  roomTexture.display();
-
-  // then render a sprite with this texture and apply the room effect
-  ngf::RenderTexture roomWithEffectTexture(target.getSize());
-  roomWithEffectTexture.clear();
-  ngf::Sprite sprite(roomTexture.getTexture());
-  sprite.draw(roomWithEffectTexture, states);
-
-  // and render overlay
-  ngf::RectangleShape fadeShape;
-  fadeShape.setSize(roomWithEffectTexture.getSize());
-  fadeShape.setColor(m_pImpl->m_pRoom->getOverlayColor());
-  fadeShape.draw(roomWithEffectTexture, {});
-  roomWithEffectTexture.display();
-
-  // render fade
-  ngf::Sprite fadeSprite;
-  float fade = m_pImpl->m_fadeEffect.effect == FadeEffect::None ? 0.f :
-               std::clamp(
-                   m_pImpl->m_fadeEffect.elapsed.getTotalSeconds() / m_pImpl->m_fadeEffect.duration.getTotalSeconds(),
-                   0.f, 1.f);
-  ngf::RenderTexture roomTexture2(target.getSize());
-  roomTexture2.setView(view);
-  roomTexture2.clear();
-  if (m_pImpl->m_fadeEffect.effect == FadeEffect::Wobble) {
-    m_pImpl->m_fadeEffect.room->draw(roomTexture2, m_pImpl->m_fadeEffect.cameraTopLeft);
-  }
-  roomTexture2.display();
-
-  ngf::RenderTexture roomTexture3(target.getSize());
-  ngf::Sprite sprite2(roomTexture2.getTexture());
-  sprite2.draw(roomTexture3, {});
-  roomTexture3.display();
-
-  const ngf::Texture *texture1{nullptr};
-  const ngf::Texture *texture2{nullptr};
-  switch (m_pImpl->m_fadeEffect.effect) {
-  case FadeEffect::Wobble:
-  case FadeEffect::In:texture1 = &roomTexture3.getTexture();
-    texture2 = &roomWithEffectTexture.getTexture();
-    break;
-  case FadeEffect::Out:texture1 = &roomWithEffectTexture.getTexture();
-    texture2 = &roomTexture3.getTexture();
-    break;
-  default:texture1 = &roomWithEffectTexture.getTexture();
-    texture2 = &roomWithEffectTexture.getTexture();
-    break;
-  }
-  fadeSprite.setTexture(*texture1);
-  m_pImpl->m_fadeShader.setUniform("u_texture2", *texture2);
-  m_pImpl->m_fadeShader.setUniform("u_fade", fade); // fade value between [0.f,1.f]
-  m_pImpl->m_fadeShader.setUniform("u_fadeToSep", m_pImpl->m_fadeEffect.fadeToSepia ? 1 : 0);  // 1 to fade to sepia
-  m_pImpl->m_fadeShader.setUniform("u_movement",
-                                   sinf(M_PI * fade) * m_pImpl->m_fadeEffect.movement); // movement for wobble effect
-  m_pImpl->m_fadeShader.setUniform("u_timer", m_pImpl->m_fadeEffect.elapsed.getTotalSeconds());
-  states.shader = &m_pImpl->m_fadeShader;
-
-  // apply the room rotation
-  auto pos = target.getView().getSize() / 2.f;
-  fadeSprite.getTransform().setOrigin(pos);
-  fadeSprite.getTransform().setPosition(pos);
-  fadeSprite.getTransform().setRotation(m_pImpl->m_pRoom->getRotation());
-  fadeSprite.draw(target, states);
+  auto overlayColor = m_pImpl->m_pRoom->getOverlayColor();
+  const auto hasFade = m_pImpl->m_fadeEffect.effect != FadeEffect::None;
+  const auto rotation = m_pImpl->m_pRoom->getRotation();
+  m_pImpl->m_renderTargets.newFrame();
+
+  if (effect == RoomEffectConstants::EFFECT_NONE && !hasFade && rotation == 0.f) {
+    // no post process effect: draw the room straight to the target
+    auto orgView = target.getView();
+    target.setView(view);
+    m_pImpl->m_pRoom->draw(target, m_pImpl->m_camera.getRect().getTopLeft());
+    target.setView(orgView);
+
+    // and render overlay
+    if (overlayColor.a != 0.f) {
+      ngf::RectangleShape fadeShape;
+      fadeShape.setSize(target.getSize());
+      fadeShape.setColor(overlayColor);
+      fadeShape.draw(target, {});
+    }
+  } else {
+    // render the room to a texture, this allows to create a post process effect: room effect
+    auto &roomTexture = m_pImpl->m_renderTargets.acquire(target.getSize());
+    roomTexture.setView(view);
+    roomTexture.clear();
+    m_pImpl->m_pRoom->draw(roomTexture, m_pImpl->m_camera.getRect().getTopLeft());
+    roomTexture.display();
+
+    // then render a sprite with this texture and apply the room effect
+    auto &roomWithEffectTexture = m_pImpl->m_renderTargets.acquire(target.getSize());
+    roomWithEffectTexture.clear();
+    ngf::Sprite sprite(roomTexture.getTexture());
+    sprite.draw(roomWithEffectTexture, states);
+
+    // and render overlay
+    if (overlayColor.a != 0.f) {
+      ngf::RectangleShape fadeShape;
+      fadeShape.setSize(roomWithEffectTexture.getSize());
+      fadeShape.setColor(overlayColor);
+      fadeShape.draw(roomWithEffectTexture, {});
+    }
+    roomWithEffectTexture.display();
+
+    // render fade
+    ngf::Sprite fadeSprite;
+    float fade = !hasFade ? 0.f :
+                 std::clamp(
+                     m_pImpl->m_fadeEffect.elapsed.getTotalSeconds()
+                         / m_pImpl->m_fadeEffect.duration.getTotalSeconds(),
+                     0.f, 1.f);
+    const ngf::Texture *texture1{&roomWithEffectTexture.getTexture()};
+    const ngf::Texture *texture2{&roomWithEffectTexture.getTexture()};
+    if (hasFade) {
+      auto &roomTexture2 = m_pImpl->m_renderTargets.acquire(target.getSize());
+      roomTexture2.setView(view);
+      roomTexture2.clear();
+      if (m_pImpl->m_fadeEffect.effect == FadeEffect::Wobble) {
+        m_pImpl->m_fadeEffect.room->draw(roomTexture2, m_pImpl->m_fadeEffect.cameraTopLeft);
+      }
+      roomTexture2.display();
+
+      auto &roomTexture3 = m_pImpl->m_renderTargets.acquire(target.getSize());
+      roomTexture3.clear();
+      ngf::Sprite sprite2(roomTexture2.getTexture());
+      sprite2.draw(roomTexture3, {});
+      roomTexture3.display();
+
+      switch (m_pImpl->m_fadeEffect.effect) {
+      case FadeEffect::Wobble:
+      case FadeEffect::In:texture1 = &roomTexture3.getTexture();
+        break;
+      case FadeEffect::Out:texture2 = &roomTexture3.getTexture();
+        break;
+      default:break;
+      }
+    }
+    fadeSprite.setTexture(*texture1);
+    m_pImpl->m_fadeShader.setUniform("u_texture2", *texture2);
+    m_pImpl->m_fadeShader.setUniform("u_fade", fade); // fade value between [0.f,1.f]
+    m_pImpl->m_fadeShader.setUniform("u_fadeToSep", m_pImpl->m_fadeEffect.fadeToSepia ? 1 : 0);  // 1 to fade to sepia
+    m_pImpl->m_fadeShader.setUniform("u_movement",
+                                     sinf(M_PI * fade) * m_pImpl->m_fadeEffect.movement); // movement for wobble effect
+    m_pImpl->m_fadeShader.setUniform("u_timer", m_pImpl->m_fadeEffect.elapsed.getTotalSeconds());
+    states.shader = &m_pImpl->m_fadeShader;
+
+    // apply the room rotation
+    auto pos = target.getView().getSize() / 2.f;
+    fadeSprite.getTransform().setOrigin(pos);
+    fadeSprite.getTransform().setPosition(pos);
+    fadeSprite.getTransform().setRotation(rotation);
+    fadeSprite.draw(target, states);
+  }
 
   // if we take a screenshot (for savegame) then stop drawing
   if (screenshot)
@@ -690,6 +714,10 @@ SoundDefinition *Engine::getSoundDefinition(const std::string &name) {
 
 bool Engine::executeCondition(const std::string &code) { return m_pImpl->m_pScriptExecute->executeCondition(code); }
 
+std::function<bool()> Engine::compileCondition(const std::string &code) {
+  return m_pImpl->m_pScriptExecute->compileCondition(code);
+}
+
 std::string Engine::executeDollar(const std::string &code) { return m_pImpl->m_pScriptExecute->executeDollar(code); }
 
 void Engine::addSelectableActor(int index, Actor *pActor) {
@@ -71,6 +71,11 @@ Engine::Impl::Impl()
   });
 
   m_fadeShader.load(Shaders::vertexShader, Shaders::fadeFragmentShader);
+  m_roomShaders[RoomEffectConstants::EFFECT_SEPIA].load(Shaders::vertexShader, Shaders::sepiaFragmentShader);
+  m_roomShaders[RoomEffectConstants::EFFECT_EGA].load(Shaders::vertexShader, Shaders::egaFragmenShader);
+  m_roomShaders[RoomEffectConstants::EFFECT_VHS].load(Shaders::vertexShader, Shaders::vhsFragmentShader);
+  m_roomShaders[RoomEffectConstants::EFFECT_GHOST].load(Shaders::vertexShader, Shaders::ghostFragmentShader);
+  m_roomShaders[RoomEffectConstants::EFFECT_BLACKANDWHITE].load(Shaders::vertexShader, Shaders::bwFragmentShader);
   uint32_t pixels[4]{0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF};
   m_blackTexture.loadFromMemory({2, 2}, pixels);
 }
@@ -283,9 +288,25 @@ void Engine::Impl::setCurrentRoom(Room *pRoom) {
   if (pRoom) {
     ScriptEngine::set("currentRoom", pRoom);
   }
+  if (m_pRoom && pRoom && m_pRoom != pRoom) {
+    m_roomExits[m_pRoom].insert(pRoom);
+  }
   m_camera.resetBounds();
   m_pRoom = pRoom;
   m_camera.at(glm::vec2(0, 0));
+  prefetchRoomExits(pRoom);
+}
+
+void Engine::Impl::prefetchRoomExits(Room *pRoom) {
+  if (!pRoom)
+    return;
+  // the rooms reached before from this room are likely to be reached again
+  auto it = m_roomExits.find(pRoom);
+  if (it == m_roomExits.end())
+    return;
+  for (auto pExitRoom : it->second) {
+    pExitRoom->prefetch();
+  }
 }
 
 void Engine::Impl::updateCutscene(const ngf::TimeSpan &elapsed) {
@@ -358,7 +379,7 @@ void Engine::Impl::updateMouseCursor() {
 Entity *Engine::Impl::getHoveredEntity(const glm::vec2 &mousPos) {
   Entity *pCurrentObject = nullptr;
 
-  // mouse on actor ?
+  // mouse on actor ? (actors are few and move while walking: they are not indexed in the hotspot grid)
   for (auto &&actor : m_actors) {
     if (actor.get() == m_pCurrentActor)
       continue;
@@ -373,15 +394,12 @@ Entity *Engine::Impl::getHoveredEntity(const glm::vec2 &mousPos) {
   }
 
   // mouse on object ?
-  const auto &objects = m_pRoom->getObjects();
-  std::for_each(objects.cbegin(), objects.cend(), [mousPos, &pCurrentObject](const auto &pObj) {
+  m_pRoom->getObjectsAt((glm::ivec2) mousPos, m_objectsAtPos);
+  std::for_each(m_objectsAtPos.cbegin(), m_objectsAtPos.cend(), [&pCurrentObject](auto pObj) {
     if (!pObj->isTouchable())
       return;
-    auto rect = pObj->getRealHotspot();
-    if (!rect.contains((glm::ivec2) mousPos))
-      return;
     if (!pCurrentObject || pObj->getZOrder() <= pCurrentObject->getZOrder())
-      pCurrentObject = pObj.get();
+      pCurrentObject = pObj;
   });
 
   if (!pCurrentObject && m_pRoom && m_pRoom->getFullscreen() != 1) {
@@ -497,18 +515,16 @@ void Engine::Impl::updateRoomScalings() const {
     return;
 
   auto &scalings = m_pRoom->getScalings();
-  auto &objects = m_pRoom->getObjects();
-  for (auto &&object : objects) {
+  m_pRoom->getObjectsAt((glm::ivec2) actor->getPosition(), m_objectsAtPos);
+  for (auto object : m_objectsAtPos) {
     if (object->getType() != ObjectType::Trigger)
       continue;
-    if (object->getRealHotspot().contains((glm::ivec2) actor->getPosition())) {
-      auto it = std::find_if(scalings.begin(), scalings.end(), [&object](const auto &s) -> bool {
-        return s.getName() == object->getName();
-      });
-      if (it != scalings.end()) {
-        m_pRoom->setRoomScaling(*it);
-        return;
-      }
+    auto it = std::find_if(scalings.begin(), scalings.end(), [object](const auto &s) -> bool {
+      return s.getName() == object->getName();
+    });
+    if (it != scalings.end()) {
+      m_pRoom->setRoomScaling(*it);
+      return;
     }
   }
   if (!scalings.empty()) {
@@ -945,8 +961,14 @@ void Engine::Impl::drawPause(ngf::RenderTarget &target) const {
 }
 
 void Engine::Impl::stopThreads() {
-  m_threads.erase(std::remove_if(m_threads.begin(), m_threads.end(), [](const auto &t) -> bool {
-    return !t || t->isStopped();
+  auto &entityManager = Locator<EntityManager>::get();
+  m_threads.erase(std::remove_if(m_threads.begin(), m_threads.end(), [&entityManager](const auto &t) -> bool {
+    if (!t)
+      return true;
+    if (!t->isStopped())
+      return false;
+    entityManager.removeThread(t.get());
+    return true;
   }), m_threads.end());
 }
 
@@ -47,6 +47,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <ngf/Graphics/Sprite.h>
 #include <ngf/Graphics/RenderTexture.h>
@@ -62,6 +63,7 @@
 #include "Entities/TalkingState.hpp"
 #include "Graphics/WalkboxDrawable.hpp"
 #include "Graphics/GraphDrawable.hpp"
+#include "Graphics/RenderTargetPool.hpp"
 #include "Shaders.hpp"
 namespace fs = std::filesystem;
 
@@ -261,8 +263,7 @@ struct Engine::Impl {
         // &: onceever
         // $: showonceever
         // ^: temponce
-        auto state = parseState(dialog);
-        states.push_back(state);
+        states.add(parseState(dialog));
         // TODO: what to do with this dialog value ?
         //auto value = property.second.getInt();
       }
@@ -401,6 +402,7 @@ struct Engine::Impl {
 
         _table(pActor->getTable())->Set(ScriptEngine::toSquirrel(property.key()), toSquirrel(property.value()));
       }
+      pActor->invalidateProperties();
       if (ScriptEngine::rawExists(pActor, "postLoad")) {
         ScriptEngine::objCall(pActor, "postLoad");
       }
@@ -501,6 +503,7 @@ struct Engine::Impl {
 
         _table(pObj->getTable())->Set(ScriptEngine::toSquirrel(property.key()), toSquirrel(property.value()));
       }
+      pObj->invalidateProperties();
     }
 
     void loadPseudoObjects(Room *pRoom, const ngf::GGPackValue &hash) {
@@ -686,10 +689,10 @@ struct Engine::Impl {
     [[nodiscard]] ngf::GGPackValue saveDialogs() const {
       ngf::GGPackValue hash;
       const auto &states = m_pImpl->m_dialogManager.getStates();
-      for (const auto &state : states) {
+      states.forEach([&hash](const auto &state) {
         std::ostringstream s;
         switch (state.mode) {
-        case DialogConditionMode::TempOnce:continue;
+        case DialogConditionMode::TempOnce:return;
         case DialogConditionMode::OnceEver:s << "&";
           break;
         case DialogConditionMode::ShowOnce:s << "#";
@@ -702,7 +705,7 @@ struct Engine::Impl {
         s << state.dialog << state.line << state.actorKey;
         // TODO: value should be 1 or another value ?
         hash[s.str()] = state.mode == DialogConditionMode::ShowOnce ? 2 : 1;
-      }
+      });
       return hash;
     }
 
@@ -877,9 +880,13 @@ struct Engine::Impl {
   Engine *m_pEngine{nullptr};
   ResourceManager &m_resourceManager;
   Room *m_pRoom{nullptr};
-  int m_roomEffect{0};
-  ngf::Shader m_roomShader;
+  /// Room effect shaders indexed by RoomEffectConstants, compiled once at startup
+  /// so that a change of effect doesn't have to compile a shader.
+  std::array<ngf::Shader, RoomEffectConstants::EFFECT_BLACKANDWHITE + 1> m_roomShaders;
   ngf::Shader m_fadeShader;
+  RenderTargetPool m_renderTargets;
+  /// Objects found by the last hit-test, kept to avoid an allocation per test.
+  mutable std::vector<Object *> m_objectsAtPos;
   ngf::Texture m_blackTexture;
   std::vector<std::unique_ptr<Actor>> m_actors;
   std::vector<std::unique_ptr<Room>> m_rooms;
@@ -930,6 +937,8 @@ struct Engine::Impl {
   bool m_autoSave{true};
   bool m_cursorVisible{true};
   FadeEffectParameters m_fadeEffect;
+  /// Rooms already reached from each room through a door, a trigger or a script.
+  std::unordered_map<Room *, std::unordered_set<Room *>> m_roomExits;
 
   Impl();
 
@@ -957,6 +966,7 @@ struct Engine::Impl {
   SQInteger exitRoom(Object *pObject);
   void updateRoomScalings() const;
   void setCurrentRoom(Room *pRoom);
+  void prefetchRoomExits(Room *pRoom);
   uint32_t getFlags(int id) const;
   uint32_t getFlags(Entity *pEntity) const;
   Entity *getHoveredEntity(const glm::vec2 &mousPos);
@@ -1,14 +1,18 @@
+#include <algorithm>
+#include <fstream>
 #include <sstream>
 #include <filesystem>
+#include <ngf/IO/Json/JsonParser.h>
 #include "engge/System/Locator.hpp"
 #include "engge/System/Logger.hpp"
 #include "engge/Engine/Preferences.hpp"
 #include "engge/Engine/EngineSettings.hpp"
 #include "../Util/Util.hpp"
+#include "MappedFile.hpp"
 namespace fs = std::filesystem;
 
 namespace {
-void throwEntryNotFound(const std::string &name) {
+[[noreturn]] void throwEntryNotFound(const std::string &name) {
   std::string s;
   s = "File '" + name + "' not found in ggpack files.";
   throw std::logic_error(s);
@@ -23,65 +27,128 @@ std::filesystem::path EngineSettings::getPath() const {
 }
 
 void EngineSettings::loadPacks() {
-  auto path = getPath();
-  for (const auto &entry : fs::directory_iterator(path)) {
+  m_entries.clear();
+  m_packs.clear();
+
+  std::vector<fs::path> packPaths;
+  for (const auto &entry : fs::directory_iterator(getPath())) {
     if (ng::startsWith(entry.path().extension().string(), ".ggpack")) {
-      auto pack = std::make_unique<ngf::GGPack>();
-      info("Opening pack '{}'...", entry.path().string());
-      pack->open(entry.path().string());
-      m_packs.push_back(std::move(pack));
+      packPaths.push_back(entry.path());
     }
   }
+  // the directory order is unspecified, sort the packs to get a deterministic precedence
+  std::sort(packPaths.begin(), packPaths.end());
+
+  // files in the working directory override the entries in the packs
+  indexOverrides(fs::current_path());
+  for (const auto &packPath : packPaths) {
+    auto pack = std::make_unique<ngf::GGPack>();
+    info("Opening pack '{}'...", packPath.string());
+    pack->open(packPath.string());
+    indexPack(*pack, getFileStamp(packPath));
+    m_packs.push_back(std::move(pack));
+  }
+  info("{} entries indexed", m_entries.size());
 }
 
-bool EngineSettings::hasEntry(const std::string &name) {
-  std::ifstream is;
-  is.open(name);
-  if (is.is_open()) {
-    is.close();
-    return true;
+void EngineSettings::indexOverrides(const fs::path &path) {
+  std::error_code ec;
+  for (const auto &entry : fs::directory_iterator(path, ec)) {
+    if (!entry.is_regular_file(ec) || ng::startsWith(entry.path().extension().string(), ".ggpack"))
+      continue;
+    auto name = entry.path().filename().string();
+    m_entries.emplace(str_toupper(name), Entry{name, nullptr, entry.path(), getFileStamp(entry.path())});
+  }
+}
+
+void EngineSettings::indexPack(ngf::GGPack &pack, uint64_t stamp) {
+  for (const auto &itEntry : pack) {
+    const auto &name = itEntry.first;
+    // emplace keeps the entry already indexed: the first pack wins
+    m_entries.emplace(str_toupper(name), Entry{name, &pack, {}, stamp});
+  }
+}
+
+uint64_t EngineSettings::getFileStamp(const fs::path &path) {
+  std::error_code ec;
+  auto size = static_cast<uint64_t>(fs::file_size(path, ec));
+  auto time = static_cast<uint64_t>(fs::last_write_time(path, ec).time_since_epoch().count());
+  return (time * 31) ^ size;
+}
+
+uint64_t EngineSettings::getEntryStamp(const std::string &name) const {
+  const auto *pEntry = findEntry(name);
+  return pEntry ? pEntry->stamp : 0;
+}
+
+const EngineSettings::Entry *EngineSettings::findEntry(const std::string &name) const {
+  auto it = m_entries.find(str_toupper(name));
+  return it == m_entries.end() ? nullptr : &it->second;
+}
+
+std::vector<char> EngineSettings::readFile(const fs::path &path, const std::string &name) {
+  // the override files are indexed at startup, they can have been removed since
+  std::ifstream is(path, std::ios::binary);
+  if (!is.is_open()) {
+    throwEntryNotFound(name);
+  }
+  is.seekg(0, std::ios::end);
+  auto size = is.tellg();
+  if (size < 0) {
+    throwEntryNotFound(name);
   }
-  auto it = std::find_if(m_packs.cbegin(), m_packs.cend(), [&name](const auto &pack) {
-    return pack->contains(name);
-  });
-  return it != m_packs.end();
+  std::vector<char> data;
+  data.resize(size);
+  is.seekg(0, std::ios::beg);
+  is.read(data.data(), size);
+  return data;
+}
+
+bool EngineSettings::hasEntry(const std::string &name) {
+  return findEntry(name) != nullptr;
 }
 
 std::vector<char> EngineSettings::readBuffer(const std::string &name) const {
-  // first try to find the resource in the filesystem
-  std::ifstream is;
-  is.open(name);
-  if (is.is_open()) {
-    is.seekg(0, std::ios::end);
-    auto size = is.tellg();
-    std::vector<char> data;
-    data.resize(size);
-    is.seekg(0, std::ios::beg);
-    is.read(data.data(), size);
-    is.close();
-    return data;
+  const auto *pEntry = findEntry(name);
+  if (!pEntry) {
+    throwEntryNotFound(name);
+  }
+  if (!pEntry->pPack) {
+    return readFile(pEntry->path, name);
   }
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return pEntry->pPack->readEntry(pEntry->name);
+}
 
-  // not found in filesystem, check in the pack files
-  auto it = std::find_if(m_packs.cbegin(), m_packs.cend(), [&name](const auto &pack) {
-    return pack->contains(name);
-  });
-  if (it != m_packs.end()) {
-    return it->get()->readEntry(name);
+EntryView EngineSettings::readView(const std::string &name) const {
+  const auto *pEntry = findEntry(name);
+  if (!pEntry) {
+    throwEntryNotFound(name);
+  }
+  if (!pEntry->pPack) {
+    auto pFile = std::make_shared<MappedFile>(pEntry->path);
+    auto data = pFile->data();
+    auto size = pFile->size();
+    return EntryView(std::move(pFile), data, size);
   }
-  throwEntryNotFound(name);
-  assert(false);
+  // pack entries are encoded, ngf::GGPack decodes them in a new buffer which is moved in the view
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return EntryView::fromBuffer(pEntry->pPack->readEntry(pEntry->name));
 }
 
 ngf::GGPackValue EngineSettings::readEntry(const std::string &name) const {
-  auto it = std::find_if(m_packs.cbegin(), m_packs.cend(), [&name](const auto &pack) {
-    return pack->contains(name);
-  });
-  if (it != m_packs.end()) {
-    return it->get()->readHashEntry(name);
+  const auto *pEntry = findEntry(name);
+  if (!pEntry) {
+    throwEntryNotFound(name);
+  }
+  if (!pEntry->pPack) {
+    // an override file is stored as plain json
+    auto buffer = readFile(pEntry->path, name);
+    buffer.push_back('\0');
+    return ngf::Json::parse(buffer.data());
   }
-  throwEntryNotFound(name);
-  assert(false);
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return pEntry->pPack->readHashEntry(pEntry->name);
 }
 
 } // namespace ng
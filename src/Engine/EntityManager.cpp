@@ -12,90 +12,97 @@
 #include <engge/System/Locator.hpp>
 
 namespace ng {
+void EntityManager::addScriptObject(ScriptObject *pObject) {
+  m_scriptObjects.add(pObject->getId(), pObject);
+}
+
+void EntityManager::removeScriptObject(const ScriptObject *pObject) {
+  m_scriptObjects.remove(pObject->getId());
+}
+
+void EntityManager::addThread(ThreadBase *pThread) {
+  m_threads.add(pThread->getId(), pThread);
+  m_threadIds[pThread->getThread()] = pThread->getId();
+}
+
+void EntityManager::removeThread(const ThreadBase *pThread) {
+  m_threads.remove(pThread->getId());
+  auto it = m_threadIds.find(pThread->getThread());
+  if (it != m_threadIds.end() && it->second == pThread->getId()) {
+    m_threadIds.erase(it);
+  }
+}
+
+void EntityManager::addSound(const std::shared_ptr<Sound> &sound) {
+  m_sounds[sound->getId()] = sound;
+  if (m_sounds.size() < m_soundsSweepSize)
+    return;
+
+  // forget the sounds which have been released since the last sweep
+  for (auto it = m_sounds.begin(); it != m_sounds.end();) {
+    if (it->second.expired()) {
+      it = m_sounds.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  m_soundsSweepSize = std::max(m_soundsSweepSize, 2 * m_sounds.size());
+}
+
 Actor *EntityManager::getActorFromId(int id) {
   if (!EntityManager::isActor(id))
     return nullptr;
-
-  for (auto &&actor : ng::Locator<ng::Engine>::get().getActors()) {
-    if (actor->getId() == id)
-      return actor.get();
-  }
-  return nullptr;
+  return static_cast<Actor *>(Locator<EntityManager>::get().m_scriptObjects.get(id));
 }
 
 Object *EntityManager::getObjectFromId(int id) {
   if (!EntityManager::isObject(id))
     return nullptr;
-  auto currentRoom = ng::Locator<ng::Engine>::get().getRoom();
-  if (currentRoom) {
-    for (auto &&obj : currentRoom->getObjects()) {
-      if (obj->getId() == id)
-        return obj.get();
-    }
-  }
-  for (auto &&room : ng::Locator<ng::Engine>::get().getRooms()) {
-    for (auto &&obj : room->getObjects()) {
-      if (obj->getId() == id)
-        return obj.get();
-    }
-  }
-  return nullptr;
+  return static_cast<Object *>(Locator<EntityManager>::get().m_scriptObjects.get(id));
 }
 
 Room *EntityManager::getRoomFromId(int id) {
   if (!EntityManager::isRoom(id))
     return nullptr;
-  for (auto &&room : ng::Locator<ng::Engine>::get().getRooms()) {
-    if (room->getId() == id)
-      return room.get();
-  }
-  return nullptr;
+  return static_cast<Room *>(Locator<EntityManager>::get().m_scriptObjects.get(id));
+}
+
+Light *EntityManager::getLightFromId(int id) {
+  if (!EntityManager::isLight(id))
+    return nullptr;
+  return static_cast<Light *>(Locator<EntityManager>::get().m_scriptObjects.get(id));
 }
 
 Sound *EntityManager::getSoundFromId(int id) {
   if (!EntityManager::isSound(id))
     return nullptr;
 
-  for (auto sound : ng::Locator<ng::Engine>::get().getSoundManager().getSoundDefinitions()) {
-    if (sound->getId() == id)
-      return sound.get();
-  }
+  auto &sounds = Locator<EntityManager>::get().m_sounds;
+  auto it = sounds.find(id);
+  if (it == sounds.end())
+    return nullptr;
 
-  for (auto sound : ng::Locator<ng::Engine>::get().getSoundManager().getSounds()) {
-    if (sound && sound->getId() == id)
-      return sound.get();
+  // the sound stays alive as long as the sound manager or a script holds it
+  auto sound = it->second.lock();
+  if (!sound) {
+    sounds.erase(it);
+    return nullptr;
   }
-  return nullptr;
+  return sound.get();
 }
 
 ThreadBase *EntityManager::getThreadFromId(int id) {
   if (!EntityManager::isThread(id))
     return nullptr;
-
-  auto &threads = ng::Locator<ng::Engine>::get().getThreads();
-  auto it = std::find_if(threads.begin(), threads.end(), [id](auto &t) -> bool {
-    return t->getId() == id;
-  });
-  if (it != threads.end())
-    return (*it).get();
-
-  return nullptr;
+  return Locator<EntityManager>::get().m_threads.get(id);
 }
 
 ThreadBase *EntityManager::getThreadFromVm(HSQUIRRELVM v) {
-  auto pCutscene = ng::Locator<ng::Engine>::get().getCutscene();
-  if (pCutscene && pCutscene->getThread() == v) {
-    return pCutscene;
-  }
-
-  auto &threads = ng::Locator<ng::Engine>::get().getThreads();
-  auto it = std::find_if(threads.begin(), threads.end(), [v](auto &t) -> bool {
-    return t->getThread() == v;
-  });
-  if (it != threads.end())
-    return (*it).get();
-
-  return nullptr;
+  auto &entityManager = Locator<EntityManager>::get();
+  auto it = entityManager.m_threadIds.find(v);
+  if (it == entityManager.m_threadIds.end())
+    return nullptr;
+  return entityManager.m_threads.get(it->second);
 }
 
 Entity *EntityManager::getEntity(HSQUIRRELVM v, SQInteger index) {
@@ -144,15 +151,14 @@ std::shared_ptr<SoundDefinition> EntityManager::getSoundDefinition(HSQUIRRELVM v
   }
   sq_pop(v, 2);
 
-  if (EntityManager::isSound(id)) {
-    for (auto sound : ng::Locator<ng::Engine>::get().getSoundManager().getSoundDefinitions()) {
-      if (sound->getId() == id) {
-        return sound;
-      }
-    }
-  }
+  if (!EntityManager::isSound(id))
+    return nullptr;
 
-  return nullptr;
+  auto &sounds = Locator<EntityManager>::get().m_sounds;
+  auto it = sounds.find(id);
+  if (it == sounds.end())
+    return nullptr;
+  return std::dynamic_pointer_cast<SoundDefinition>(it->second.lock());
 }
 
 std::shared_ptr<SoundDefinition> EntityManager::getSoundDefinition(HSQUIRRELVM v, const std::string &name) {
@@ -2,6 +2,7 @@
 #include "engge/Engine/Hud.hpp"
 #include "engge/Engine/Preferences.hpp"
 #include "engge/Graphics/Screen.hpp"
+#include "engge/Graphics/SpriteBatch.hpp"
 #include "engge/Graphics/SpriteSheet.hpp"
 #include "engge/Scripting/ScriptEngine.hpp"
 #include "engge/System/Locator.hpp"
@@ -33,6 +34,7 @@ void Hud::setTextureManager(ResourceManager *pTextureManager) {
 
 void Hud::setVerb(int characterSlot, int verbSlot, const Verb &verb) {
   m_verbSlots.at(characterSlot).setVerb(verbSlot, verb);
+  m_isDirty = true;
 }
 
 [[nodiscard]] const VerbSlot &Hud::getVerbSlot(int characterSlot) const {
@@ -41,6 +43,7 @@ void Hud::setVerb(int characterSlot, int verbSlot, const Verb &verb) {
 
 void Hud::setVerbUiColors(int characterSlot, VerbUiColors colors) {
   m_verbUiColors.at(characterSlot) = colors;
+  m_isDirty = true;
 }
 
 [[nodiscard]] const VerbUiColors &Hud::getVerbUiColors(int characterSlot) const {
@@ -69,10 +72,36 @@ void Hud::draw(ngf::RenderTarget &target, ngf::RenderStates) const {
     }
   }
 
+  if (m_isDirty || m_composedActorIndex != m_currentActorIndex || m_composedVerbId != verbId
+      || m_composedAlpha != m_alpha) {
+    composeVerbs(verbId);
+  }
+
   const auto view = target.getView();
   target.setView(ngf::View(ngf::frect::fromPositionSize({0, 0}, {Screen::Width, Screen::Height})));
 
   // draw UI background
+  ngf::RenderStates backingStates;
+  backingStates.texture = m_pGameTexture.get();
+  target.draw(ngf::PrimitiveType::Triangles, m_backingVertices, backingStates);
+
+  // draw verbs
+  ngf::RenderStates verbStates;
+  verbStates.shader = &m_verbShader;
+  verbStates.texture = m_pVerbTexture.get();
+  target.draw(ngf::PrimitiveType::Triangles, m_verbVertices, verbStates);
+
+  target.setView(view);
+
+  m_inventory.draw(target, {});
+}
+
+void Hud::composeVerbs(int highlightedVerbId) const {
+  m_isDirty = false;
+  m_composedActorIndex = m_currentActorIndex;
+  m_composedVerbId = highlightedVerbId;
+  m_composedAlpha = m_alpha;
+
   const auto &preferences = Locator<Preferences>::get();
   auto hudSentence = preferences.getUserPreference(PreferenceNames::HudSentence, PreferenceDefaultValues::HudSentence);
   auto uiBackingAlpha =
@@ -82,39 +111,46 @@ void Hud::draw(ngf::RenderTarget &target, ngf::RenderStates) const {
   const auto &verbUiColors = getVerbUiColors(m_currentActorIndex);
   auto verbHighlight = invertVerbHighlight ? ngf::Colors::White : verbUiColors.verbHighlight;
   auto verbColor = invertVerbHighlight ? verbUiColors.verbHighlight : ngf::Colors::White;
-  auto &gameSheet = Locator<ResourceManager>::get().getSpriteSheet("GameSheet");
-  auto uiBackingRect = hudSentence ? gameSheet.getRect("ui_backing_tall") : gameSheet.getRect("ui_backing");
 
-  ngf::Sprite uiBacking(*gameSheet.getTexture(), uiBackingRect);
-  uiBacking.setColor(ngf::Color(0.f, 0.f, 0.f, uiBackingAlpha * m_alpha));
-  uiBacking.getTransform().setPosition({0, 720.f - uiBackingRect.getHeight()});
-  uiBacking.draw(target, {});
+  // UI background
+  const auto &gameSheet = Locator<ResourceManager>::get().getSpriteSheet("GameSheet");
+  auto uiBackingRect = hudSentence ? gameSheet.getRect("ui_backing_tall") : gameSheet.getRect("ui_backing");
+  m_pGameTexture = gameSheet.getTexture();
+  ngf::Transform backingTransform;
+  backingTransform.setPosition({0, 720.f - uiBackingRect.getHeight()});
+  m_backingVertices.clear();
+  SpriteBatch::appendSprite(m_backingVertices,
+                            *m_pGameTexture,
+                            uiBackingRect,
+                            ngf::Color(0.f, 0.f, 0.f, uiBackingAlpha * m_alpha),
+                            backingTransform.getTransform());
 
   m_verbShader.setUniform("u_ranges", glm::vec2(0.8f, 0.8f));
   m_verbShader.setUniform4("u_shadowColor", verbUiColors.verbNormalTint);
   m_verbShader.setUniform4("u_normalColor", verbUiColors.verbHighlight);
   m_verbShader.setUniform4("u_highlightColor", verbUiColors.verbHighlightTint);
 
-  ngf::RenderStates verbStates;
-  verbStates.shader = &m_verbShader;
-  auto &verbSheet = Locator<ResourceManager>::get().getSpriteSheet("VerbSheet");
+  // verbs
+  const auto &verbSheet = Locator<ResourceManager>::get().getSpriteSheet("VerbSheet");
+  m_pVerbTexture = verbSheet.getTexture();
+  m_verbVertices.clear();
   for (int i = 1; i <= 9; i++) {
     auto verb = getVerbSlot(m_currentActorIndex).getVerb(i);
-    auto color = verb.id == verbId ? verbHighlight : verbColor;
+    auto color = verb.id == highlightedVerbId ? verbHighlight : verbColor;
     color.a = m_alpha;
 
     auto verbName = getVerbName(verb);
     auto rect = verbSheet.getRect(verbName);
     auto s = verbSheet.getSpriteSourceSize(verbName);
-    ngf::Sprite verbSprite(*verbSheet.getTexture(), rect);
-    verbSprite.setColor(color);
-    verbSprite.getTransform().setPosition(s.getTopLeft());
-    verbSprite.draw(target, verbStates);
+    ngf::Transform verbTransform;
+    verbTransform.setPosition(s.getTopLeft());
+    SpriteBatch::appendSprite(m_verbVertices, *m_pVerbTexture, rect, color, verbTransform.getTransform());
   }
+}
 
-  target.setView(view);
-
-  m_inventory.draw(target, {});
+void Hud::invalidatePreferences() {
+  m_isDirty = true;
+  m_inventory.invalidatePreferences();
 }
 
 void Hud::setCurrentActorIndex(int index) {
@@ -1,5 +1,5 @@
 #include <algorithm>
-#include <ngf/Graphics/RectangleShape.h>
+#include <cmath>
 #include <ngf/Graphics/Sprite.h>
 #include <ngf/System/Mouse.h>
 #include <engge/Engine/Engine.hpp>
@@ -8,6 +8,7 @@
 #include <engge/Engine/Preferences.hpp>
 #include <engge/Room/Room.hpp>
 #include <engge/Graphics/Screen.hpp>
+#include <engge/Graphics/SpriteBatch.hpp>
 #include <engge/System/Locator.hpp>
 
 namespace ng {
@@ -98,125 +99,167 @@ bool Inventory::update(const ngf::TimeSpan &elapsed) {
   return false;
 }
 
-void Inventory::drawUpArrow(ngf::RenderTarget &target) const {
-  if (!hasUpArrow())
-    return;
-
-  const auto &preferences = Locator<Preferences>::get();
-  auto isRetro =
-      preferences.getUserPreference(PreferenceNames::RetroVerbs, PreferenceDefaultValues::RetroVerbs);
-  auto rect = m_gameSheet.getRect(isRetro ? "scroll_up_retro" : "scroll_up");
+bool Inventory::hasUpArrow() const {
+  auto inventoryOffset = m_pCurrentActor->getInventoryOffset();
+  return inventoryOffset != 0;
+}
 
-  auto color = m_pColors->verbNormal;
-  color.a = m_alpha;
+bool Inventory::hasDownArrow() const {
+  const auto &objects = m_pCurrentActor->getObjects();
+  auto inventoryOffset = m_pCurrentActor->getInventoryOffset();
+  return static_cast<int>(objects.size()) > (inventoryOffset * 4 + 8);
+}
 
-  glm::vec2 scrollUpSize(rect.getWidth(), rect.getHeight());
-  ngf::RectangleShape scrollUpShape;
-  scrollUpShape.setColor(color);
-  scrollUpShape.getTransform().setPosition(m_scrollUpRect.getTopLeft());
-  scrollUpShape.setSize(scrollUpSize);
-  scrollUpShape.setTexture(*m_gameSheet.getTexture(), false);
-  scrollUpShape.setTextureRect(m_gameSheet.getTexture()->computeTextureCoords(rect));
-  scrollUpShape.draw(target, {});
+bool Inventory::equals(const PanelState &state1, const PanelState &state2) {
+  auto equalColors = [](const ngf::Color &c1, const ngf::Color &c2) {
+    return c1.r == c2.r && c1.g == c2.g && c1.b == c2.b && c1.a == c2.a;
+  };
+  return state1.hasUpArrow == state2.hasUpArrow && state1.hasDownArrow == state2.hasDownArrow
+      && equalColors(state1.backgroundColor, state2.backgroundColor)
+      && equalColors(state1.arrowColor, state2.arrowColor);
 }
 
-void Inventory::drawDownArrow(ngf::RenderTarget &target) const {
-  if (!hasDownArrow())
-    return;
+void Inventory::composePanel(const PanelState &state) const {
+  m_panelState = state;
+  m_isPanelDirty = false;
+  m_pGameTexture = m_gameSheet.getTexture();
+  m_panelVertices.clear();
 
+  // slots backgrounds
+  auto inventoryRect = m_gameSheet.getRect("inventory_background");
+  for (const auto &rect : m_inventoryRects) {
+    ngf::Transform transform;
+    transform.setPosition(rect.getTopLeft());
+    transform.setOrigin({rect.getWidth() / 2.f, rect.getHeight() / 2.f});
+    SpriteBatch::appendSprite(m_panelVertices,
+                              *m_pGameTexture,
+                              inventoryRect,
+                              state.backgroundColor,
+                              transform.getTransform());
+  }
+
+  // scroll arrows
   const auto &preferences = Locator<Preferences>::get();
   auto isRetro =
       preferences.getUserPreference(PreferenceNames::RetroVerbs, PreferenceDefaultValues::RetroVerbs);
-
-  auto scrollDownFrameRect = m_gameSheet.getRect(isRetro ? "scroll_down_retro" : "scroll_down");
-  glm::vec2 scrollDownSize(scrollDownFrameRect.getWidth(), scrollDownFrameRect.getHeight());
-
-  auto color = m_pColors->verbNormal;
-  color.a = m_alpha;
-
-  ngf::RectangleShape scrollDownShape;
-  scrollDownShape.setColor(color);
-  scrollDownShape.getTransform().setPosition(m_scrollDownRect.getTopLeft());
-  scrollDownShape.setSize(scrollDownSize);
-  scrollDownShape.setTexture(*m_gameSheet.getTexture(), false);
-  scrollDownShape.setTextureRect(m_gameSheet.getTexture()->computeTextureCoords(scrollDownFrameRect));
-  scrollDownShape.draw(target, {});
+  if (state.hasUpArrow) {
+    appendArrow(isRetro ? "scroll_up_retro" : "scroll_up", m_scrollUpRect, state.arrowColor);
+  }
+  if (state.hasDownArrow) {
+    appendArrow(isRetro ? "scroll_down_retro" : "scroll_down", m_scrollDownRect, state.arrowColor);
+  }
 }
 
-bool Inventory::hasUpArrow() const {
-  auto inventoryOffset = m_pCurrentActor->getInventoryOffset();
-  return inventoryOffset != 0;
+void Inventory::appendArrow(const std::string &name, const ngf::frect &rect, ngf::Color color) const {
+  ngf::Transform transform;
+  transform.setPosition(rect.getTopLeft());
+  SpriteBatch::appendSprite(m_panelVertices,
+                            *m_pGameTexture,
+                            m_gameSheet.getRect(name),
+                            color,
+                            transform.getTransform());
 }
 
-bool Inventory::hasDownArrow() const {
+bool Inventory::updateSlots() const {
   const auto &objects = m_pCurrentActor->getObjects();
-  auto inventoryOffset = m_pCurrentActor->getInventoryOffset();
-  return static_cast<int>(objects.size()) > (inventoryOffset * 4 + 8);
-}
+  auto inventoryOffset = static_cast<size_t>(m_pCurrentActor->getInventoryOffset() * 4);
+  auto hasChanged = false;
+  for (size_t i = 0; i < m_slots.size(); i++) {
+    auto &slot = m_slots[i];
+    const Object *pObject = (inventoryOffset + i) < objects.size() ? objects[inventoryOffset + i] : nullptr;
+    if (!pObject) {
+      if (slot.pObject) {
+        slot = Slot();
+        hasChanged = true;
+      }
+      continue;
+    }
 
-void Inventory::draw(ngf::RenderTarget &target, ngf::RenderStates) const {
-  if (m_currentActorIndex == -1)
-    return;
+    // jiggling and popping objects are animated, compose them once more when they stop to be at rest
+    auto isAnimated = pObject->getJiggle() || pObject->getPop() > 0;
+    if (isAnimated || slot.isAnimated) {
+      hasChanged = true;
+    }
+    slot.isAnimated = isAnimated;
 
-  const auto view = target.getView();
-  target.setView(ngf::View(ngf::frect::fromPositionSize({0, 0}, {Screen::Width, Screen::Height})));
+    auto icon = pObject->getIcon();
+    if (slot.pObject == pObject && slot.icon == icon)
+      continue;
 
-  auto color = ngf::Colors::White;
-  color.a = m_alpha;
+    auto spriteSourceSize = m_inventoryItems.getSpriteSourceSize(icon);
+    auto sourceSize = m_inventoryItems.getSourceSize(icon);
+    slot.pObject = pObject;
+    slot.rect = m_inventoryItems.getRect(icon);
+    slot.origin = {sourceSize.x / 2.f - spriteSourceSize.getTopLeft().x,
+                   sourceSize.y / 2.f - spriteSourceSize.getTopLeft().y};
+    slot.icon = std::move(icon);
+    hasChanged = true;
+  }
+  return hasChanged;
+}
 
-  // draw inventory items
-  ngf::Color c(m_pColors->inventoryBackground);
-  c.a = m_alpha * 0.5f;
+void Inventory::composeItems() const {
+  m_composedItemsAlpha = m_alpha;
+  m_pItemsTexture = m_inventoryItems.getTexture();
+  m_itemVertices.clear();
 
-  auto inventoryRect = m_gameSheet.getRect("inventory_background");
-  ngf::Sprite inventoryShape;
-  inventoryShape.setColor(c);
-  inventoryShape.setTexture(*m_gameSheet.getTexture());
-  inventoryShape.setTextureRect(inventoryRect);
-  for (auto i = 0; i < 8; i++) {
-    inventoryShape.getTransform().setPosition(m_inventoryRects[i].getTopLeft());
-    inventoryShape.getTransform().setOrigin({m_inventoryRects[i].getWidth() / 2.f,
-                                             m_inventoryRects[i].getHeight() / 2.f});
-    inventoryShape.draw(target);
+  auto color = ngf::Colors::White;
+  color.a = m_alpha;
+  for (size_t i = 0; i < m_slots.size(); i++) {
+    const auto &slot = m_slots[i];
+    if (!slot.pObject)
+      continue;
+
+    ngf::Transform transform;
+    transform.setOrigin(slot.origin);
+    if (slot.pObject->getJiggle()) {
+      transform.setRotation(3.f * sinf(m_jiggleTime));
+    }
+    transform.setPosition(m_inventoryRects[i].getTopLeft());
+    if (slot.pObject->getPop() > 0) {
+      const auto pop = 4.25f + slot.pObject->getPopScale() * 0.25f;
+      transform.setScale({pop, pop});
+    } else {
+      transform.setScale({4, 4});
+    }
+    SpriteBatch::appendSprite(m_itemVertices, *m_pItemsTexture, slot.rect, color, transform.getTransform());
   }
+}
 
-  // draw inventory objects
-  if (!m_pCurrentActor) {
-    target.setView(view);
+void Inventory::draw(ngf::RenderTarget &target, ngf::RenderStates) const {
+  if (m_currentActorIndex == -1)
     return;
+
+  // compose the panel again only when it changes
+  PanelState state;
+  state.hasUpArrow = m_pCurrentActor && hasUpArrow();
+  state.hasDownArrow = m_pCurrentActor && hasDownArrow();
+  state.backgroundColor = m_pColors->inventoryBackground;
+  state.backgroundColor.a = m_alpha * 0.5f;
+  state.arrowColor = m_pColors->verbNormal;
+  state.arrowColor.a = m_alpha;
+  if (m_isPanelDirty || !equals(state, m_panelState)) {
+    composePanel(state);
   }
 
-  auto &objects = m_pCurrentActor->getObjects();
-  drawUpArrow(target);
-  drawDownArrow(target);
+  const auto view = target.getView();
+  target.setView(ngf::View(ngf::frect::fromPositionSize({0, 0}, {Screen::Width, Screen::Height})));
 
-  auto inventoryOffset = m_pCurrentActor->getInventoryOffset();
-  auto count = std::min((size_t) 8, objects.size() - inventoryOffset * 4);
-  for (size_t i = 0; i < count; i++) {
-    auto &object = objects.at(inventoryOffset * 4 + i);
-    auto icon = object->getIcon();
-    auto rect = m_inventoryItems.getRect(icon);
-    auto spriteSourceSize = m_inventoryItems.getSpriteSourceSize(icon);
-    auto sourceSize = m_inventoryItems.getSourceSize(icon);
-    glm::vec2 origin
-        (sourceSize.x / 2.f - spriteSourceSize.getTopLeft().x, sourceSize.y / 2.f - spriteSourceSize.getTopLeft().y);
+  // draw inventory slots and arrows
+  ngf::RenderStates panelStates;
+  panelStates.texture = m_pGameTexture.get();
+  target.draw(ngf::PrimitiveType::Triangles, m_panelVertices, panelStates);
 
-    ngf::Sprite sprite;
-    sprite.getTransform().setOrigin(origin);
-    if (object->getJiggle()) {
-      sprite.getTransform().setRotation(3.f * sinf(m_jiggleTime));
+  // draw inventory objects
+  if (m_pCurrentActor) {
+    if (updateSlots() || m_composedItemsAlpha != m_alpha) {
+      composeItems();
     }
-    sprite.getTransform().setPosition(m_inventoryRects[i].getTopLeft());
-    sprite.setTexture(*m_inventoryItems.getTexture());
-    sprite.setTextureRect(rect);
-    if (object->getPop() > 0) {
-      const auto pop = 4.25f + object->getPopScale() * 0.25f;
-      sprite.getTransform().setScale({pop, pop});
-    } else {
-      sprite.getTransform().setScale({4, 4});
+    if (!m_itemVertices.empty()) {
+      ngf::RenderStates itemStates;
+      itemStates.texture = m_pItemsTexture.get();
+      target.draw(ngf::PrimitiveType::Triangles, m_itemVertices, itemStates);
     }
-    sprite.setColor(color);
-    sprite.draw(target, {});
   }
   target.setView(view);
 }
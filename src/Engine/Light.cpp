@@ -6,8 +6,11 @@ namespace ng {
 Light::Light() {
   sq_resetobject(&table);
   m_id = Locator<EntityManager>::get().getLightId();
+  Locator<EntityManager>::get().addScriptObject(this);
 }
 
-Light::~Light() = default;
+Light::~Light() {
+  Locator<EntityManager>::get().removeScriptObject(this);
+}
 
 } // namespace ng
@@ -0,0 +1,87 @@
+#include <stdexcept>
+#include "MappedFile.hpp"
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace ng {
+namespace {
+[[noreturn]] void throwMappingFailed(const std::filesystem::path &path) {
+  throw std::runtime_error("Failed to map file '" + path.string() + "'");
+}
+}
+
+#ifdef WIN32
+MappedFile::MappedFile(const std::filesystem::path &path) {
+  m_hFile = CreateFileW(path.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                        FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (m_hFile == INVALID_HANDLE_VALUE) {
+    m_hFile = nullptr;
+    throwMappingFailed(path);
+  }
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(m_hFile, &size)) {
+    CloseHandle(m_hFile);
+    throwMappingFailed(path);
+  }
+  m_size = static_cast<size_t>(size.QuadPart);
+  if (m_size == 0)
+    return;
+
+  m_hMapping = CreateFileMappingW(m_hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (!m_hMapping) {
+    CloseHandle(m_hFile);
+    throwMappingFailed(path);
+  }
+  m_pData = static_cast<const char *>(MapViewOfFile(m_hMapping, FILE_MAP_READ, 0, 0, 0));
+  if (!m_pData) {
+    CloseHandle(m_hMapping);
+    CloseHandle(m_hFile);
+    throwMappingFailed(path);
+  }
+}
+
+MappedFile::~MappedFile() {
+  if (m_pData)
+    UnmapViewOfFile(m_pData);
+  if (m_hMapping)
+    CloseHandle(m_hMapping);
+  if (m_hFile)
+    CloseHandle(m_hFile);
+}
+#else
+MappedFile::MappedFile(const std::filesystem::path &path) {
+  auto fd = ::open(path.c_str(), O_RDONLY);
+  if (fd == -1)
+    throwMappingFailed(path);
+
+  struct stat st{};
+  if (::fstat(fd, &st) == -1) {
+    ::close(fd);
+    throwMappingFailed(path);
+  }
+  m_size = static_cast<size_t>(st.st_size);
+  if (m_size == 0) {
+    ::close(fd);
+    return;
+  }
+
+  auto pData = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  // the mapping stays valid once the file is closed
+  ::close(fd);
+  if (pData == MAP_FAILED)
+    throwMappingFailed(path);
+  m_pData = static_cast<const char *>(pData);
+}
+
+MappedFile::~MappedFile() {
+  if (m_pData)
+    ::munmap(const_cast<char *>(m_pData), m_size);
+}
+#endif
+} // namespace ng
@@ -0,0 +1,25 @@
+#pragma once
+#include <cstddef>
+#include <filesystem>
+#include <engge/System/NonCopyable.hpp>
+
+namespace ng {
+/// @brief Read-only memory mapping of a whole file.
+class MappedFile : public NonCopyable {
+public:
+  /// Maps the file in memory, throws a std::runtime_error on failure.
+  explicit MappedFile(const std::filesystem::path &path);
+  ~MappedFile();
+
+  [[nodiscard]] const char *data() const { return m_pData; }
+  [[nodiscard]] size_t size() const { return m_size; }
+
+private:
+  const char *m_pData{nullptr};
+  size_t m_size{0};
+#ifdef WIN32
+  void *m_hFile{nullptr};
+  void *m_hMapping{nullptr};
+#endif
+};
+} // namespace ng
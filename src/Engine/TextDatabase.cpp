@@ -1,5 +1,6 @@
 #include <regex>
 #include "engge/System/Logger.hpp"
+#include "engge/Engine/AssetCache.hpp"
 #include "engge/Engine/EngineSettings.hpp"
 #include "engge/Engine/TextDatabase.hpp"
 #include "../Util/Util.hpp"
@@ -9,9 +10,12 @@ TextDatabase::TextDatabase() = default;
 
 void TextDatabase::load(const std::string &path) {
   m_texts.clear();
+  if (loadFromCache(path))
+    return;
+
   std::wregex re(L"^(\\d+)\\s+(.*)$");
   auto buffer = Locator<EngineSettings>::get().readBuffer(path);
-  GGPackBufferStream input(buffer);
+  GGPackBufferStream input(std::move(buffer));
   std::wstring line;
   while (getLine(input, line)) {
     std::wsmatch matches;
@@ -23,6 +27,39 @@ void TextDatabase::load(const std::string &path) {
     auto text = matches[2].str();
     m_texts.insert(std::make_pair(num, text));
   }
+  saveToCache(path);
+}
+
+bool TextDatabase::loadFromCache(const std::string &path) {
+  std::vector<char> data;
+  if (!Locator<AssetCache>::get().read("text", path, data))
+    return false;
+
+  AssetCacheReader reader(data);
+  auto count = reader.read<uint32_t>();
+  for (uint32_t i = 0; i < count && reader.isValid(); ++i) {
+    auto id = reader.read<int32_t>();
+    m_texts.insert(std::make_pair(id, reader.readString<wchar_t>()));
+  }
+  if (reader.isValid())
+    return true;
+
+  m_texts.clear();
+  return false;
+}
+
+void TextDatabase::saveToCache(const std::string &path) const {
+  const auto &cache = Locator<AssetCache>::get();
+  if (!cache.isEnabled())
+    return;
+
+  AssetCacheWriter writer;
+  writer.write(static_cast<uint32_t>(m_texts.size()));
+  for (const auto &[id, text] : m_texts) {
+    writer.write(static_cast<int32_t>(id));
+    writer.writeString(text);
+  }
+  cache.write("text", path, writer.getData());
 }
 
 std::wstring TextDatabase::getText(int id) const {
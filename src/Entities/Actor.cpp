@@ -45,6 +45,9 @@ struct Actor::Impl {
   void setActor(Actor *pActor) {
     _pActor = pActor;
     _walkingState.setActor(pActor);
+    _walkingState.setPathCallback([this](const std::vector<glm::vec2> &path) {
+      _path = std::make_unique<PathDrawable>(path);
+    });
     _costume.setActor(pActor);
   }
 
@@ -170,9 +173,12 @@ bool Actor::isInventoryObject() const { return false; }
 Actor::Actor(Engine &engine) : m_pImpl(std::make_unique<Impl>(engine)) {
   m_pImpl->setActor(this);
   m_id = Locator<EntityManager>::get().getActorId();
+  Locator<EntityManager>::get().addScriptObject(this);
 }
 
-Actor::~Actor() = default;
+Actor::~Actor() {
+  Locator<EntityManager>::get().removeScriptObject(this);
+}
 
 const Room *Actor::getRoom() const { return m_pImpl->_pRoom; }
 
@@ -237,13 +243,18 @@ std::vector<glm::vec2> Actor::walkTo(const glm::vec2 &destination, std::optional
   }
 
   m_pImpl->_path = std::make_unique<PathDrawable>(path);
-  if (ScriptEngine::rawExists(this, "preWalking")) {
-    ScriptEngine::rawCall(this, "preWalking");
-  }
   m_pImpl->_walkingState.setDestination(path, facing);
   return path;
 }
 
+void Actor::walkToAsync(const glm::vec2 &destination, std::optional<Facing> facing) {
+  if (m_pImpl->_pRoom == nullptr || !m_pImpl->_useWalkboxes) {
+    walkTo(destination, facing);
+    return;
+  }
+  m_pImpl->_walkingState.setDestination(m_pImpl->_pRoom->calculatePathAsync(getPosition(), destination), facing);
+}
+
 void Actor::setFps(int fps) {
   m_pImpl->_fps = fps;
 }
@@ -4,7 +4,7 @@
 #include <engge/Entities/Actor.hpp>
 #include <engge/Entities/BlinkState.hpp>
 #include <engge/Entities/Costume.hpp>
-#include <engge/Engine/EngineSettings.hpp>
+#include <engge/Engine/AssetCache.hpp>
 #include <engge/System/Locator.hpp>
 #include <engge/Entities/AnimationLoader.hpp>
 #include <engge/Room/Room.hpp>
@@ -120,7 +120,7 @@ void Costume::loadCostume(const std::string &path, const std::string &sheet) {
   if (!costumePath.has_extension()) {
     costumePath.replace_extension(".json");
   }
-  auto hash = Locator<EngineSettings>::get().readEntry(costumePath.string());
+  auto hash = Locator<AssetCache>::get().readHashEntry(costumePath.string());
   if (costumeSheet.empty()) {
     costumeSheet = hash["sheet"].getString();
   }
@@ -37,6 +37,12 @@ struct Entity::Impl {
   ngf::Transform m_transform;
   Entity *m_pParent{nullptr};
   std::vector<Entity *> m_children;
+  // native copies of the properties stored in the script table, read at most once per frame
+  mutable bool m_arePropertiesDirty{true};
+  mutable int m_propertiesFrame{-1};
+  mutable bool m_isVisible{true};
+  mutable bool m_isTouchable{true};
+  mutable ngf::Color m_color{ngf::Colors::White};
 
   Impl() : m_engine(ng::Locator<ng::Engine>::get()) {
     m_talkingState.setEngine(&m_engine);
@@ -55,6 +61,35 @@ struct Entity::Impl {
       return std::make_optional(value);
     return std::nullopt;
   }
+
+  void readProperties(const Entity &entity) const {
+    // the scripts can assign these properties in the table directly, so they are read again each frame
+    auto frame = m_engine.getFrameCounter();
+    if (!m_arePropertiesDirty && m_propertiesFrame == frame)
+      return;
+    m_arePropertiesDirty = false;
+    m_propertiesFrame = frame;
+
+    auto &table = entity.getTable();
+    auto hidden = false;
+    ScriptEngine::rawGet(table, "_hidden", hidden);
+    m_isVisible = !hidden;
+
+    int touchable = 1;
+    if (!ScriptEngine::rawGet(table, "_touchable", touchable)) {
+      ScriptEngine::rawGet(table, "initTouchable", touchable);
+    }
+    m_isTouchable = touchable != 0;
+
+    auto color = toInteger(ngf::Colors::White);
+    ScriptEngine::rawGet(table, "_color", color);
+    m_color = fromRgba(color);
+  }
+
+  void setColor(Entity &entity, const ngf::Color &color) {
+    m_color = color;
+    ScriptEngine::set(entity.getTable(), "_color", toInteger(color));
+  }
 };
 
 Entity::Entity() : m_pImpl(std::make_unique<Entity::Impl>()) {
@@ -95,13 +130,20 @@ bool Entity::isLit() const {
 }
 
 void Entity::setVisible(bool isVisible) {
+  m_pImpl->readProperties(*this);
+  if (m_pImpl->m_isVisible == isVisible)
+    return;
+  m_pImpl->m_isVisible = isVisible;
   ScriptEngine::set(getTable(), "_hidden", !isVisible);
 }
 
 bool Entity::isVisible() const {
-  auto hidden = false;
-  ScriptEngine::rawGet(getTable(), "_hidden", hidden);
-  return !hidden;
+  m_pImpl->readProperties(*this);
+  return m_pImpl->m_isVisible;
+}
+
+void Entity::invalidateProperties() {
+  m_pImpl->m_arePropertiesDirty = true;
 }
 
 void Entity::setUsePosition(std::optional<glm::vec2> pos) {
@@ -119,6 +161,7 @@ std::optional<UseDirection> Entity::getUseDirection() const {
 void Entity::setPosition(const glm::vec2 &pos) {
   m_pImpl->m_transform.setPosition(pos);
   m_pImpl->m_moveTo.isEnabled = false;
+  onTransformChanged();
 }
 
 glm::vec2 Entity::getPosition() const {
@@ -132,6 +175,7 @@ glm::vec2 Entity::getRealPosition() const {
 void Entity::setOffset(const glm::vec2 &offset) {
   m_pImpl->m_offset = offset;
   m_pImpl->m_offsetTo.isEnabled = false;
+  onTransformChanged();
 }
 
 glm::vec2 Entity::getOffset() const {
@@ -141,6 +185,7 @@ glm::vec2 Entity::getOffset() const {
 void Entity::setRotation(float angle) {
   m_pImpl->m_transform.setRotation(angle);
   m_pImpl->m_rotateTo.isEnabled = false;
+  onTransformChanged();
 }
 
 float Entity::getRotation() const {
@@ -153,25 +198,28 @@ float Entity::getRotation() const {
 }
 
 void Entity::setColor(const ngf::Color &color) {
-  ScriptEngine::set(getTable(), "_color", toInteger(color));
+  m_pImpl->setColor(*this, color);
   m_pImpl->m_alphaTo.isEnabled = false;
 }
 
 ngf::Color Entity::getColor() const {
-  auto color = toInteger(ngf::Colors::White);
-  ScriptEngine::rawGet(getTable(), "_color", color);
-  return fromRgba(color);
+  m_pImpl->readProperties(*this);
+  return m_pImpl->m_color;
 }
 
 void Entity::setScale(float s) {
   m_pImpl->m_transform.setScale({s, s});
   m_pImpl->m_scaleTo.isEnabled = false;
+  onTransformChanged();
 }
 
 float Entity::getScale() const {
   return m_pImpl->m_transform.getScale().x;
 }
 
+void Entity::onTransformChanged() {
+}
+
 ngf::Transform Entity::getTransform() const {
   auto transform = m_pImpl->m_transform;
   transform.move(getOffset());
@@ -234,17 +282,13 @@ uint32_t Entity::getFlags() const {
 }
 
 void Entity::setTouchable(bool isTouchable) {
+  m_pImpl->m_isTouchable = isTouchable;
   ScriptEngine::set(getTable(), "_touchable", isTouchable);
 }
 
 bool Entity::isTouchable() const {
-  if (!isVisible())
-    return false;
-  int touchable = 1;
-  if (!ScriptEngine::rawGet(getTable(), "_touchable", touchable)) {
-    ScriptEngine::rawGet(getTable(), "initTouchable", touchable);
-  }
-  return touchable != 0;
+  m_pImpl->readProperties(*this);
+  return m_pImpl->m_isVisible && m_pImpl->m_isTouchable;
 }
 
 void Entity::setRenderOffset(const glm::ivec2 &offset) {
@@ -256,14 +300,20 @@ glm::ivec2 Entity::getRenderOffset() const {
 }
 
 void Entity::shake(float amount) {
-  auto setShake = [this](const auto &offset) { m_pImpl->m_shakeOffset = offset; };
+  auto setShake = [this](const auto &offset) {
+    m_pImpl->m_shakeOffset = offset;
+    onTransformChanged();
+  };
   auto shake = std::make_unique<ShakeFunction>(setShake, amount);
   m_pImpl->m_shake.function = std::move(shake);
   m_pImpl->m_shake.isEnabled = true;
 }
 
 void Entity::jiggle(float amount) {
-  auto setJiggle = [this](const auto &offset) { m_pImpl->m_jiggleOffset = offset; };
+  auto setJiggle = [this](const auto &offset) {
+    m_pImpl->m_jiggleOffset = offset;
+    onTransformChanged();
+  };
   auto jiggle = std::make_unique<JiggleFunction>(setJiggle, amount);
   m_pImpl->m_jiggle.function = std::move(jiggle);
   m_pImpl->m_jiggle.isEnabled = true;
@@ -274,7 +324,7 @@ void Entity::alphaTo(float destination, ngf::TimeSpan time, InterpolationMethod
   auto setAlpha = [this](const float &a) {
     auto color = getColor();
     color.a = a;
-    ScriptEngine::set(getTable(), "_color", toInteger(color));
+    m_pImpl->setColor(*this, color);
   };
   auto alphaTo = std::make_unique<ChangeProperty<float>>(getAlpha, setAlpha, destination, time, method);
   m_pImpl->m_alphaTo.function = std::move(alphaTo);
@@ -283,7 +333,10 @@ void Entity::alphaTo(float destination, ngf::TimeSpan time, InterpolationMethod
 
 void Entity::offsetTo(glm::vec2 destination, ngf::TimeSpan time, InterpolationMethod method) {
   auto get = [this] { return m_pImpl->m_offset; };
-  auto set = [this](const glm::vec2 &value) { m_pImpl->m_offset = value; };
+  auto set = [this](const glm::vec2 &value) {
+    m_pImpl->m_offset = value;
+    onTransformChanged();
+  };
   auto offsetTo = std::make_unique<ChangeProperty<glm::vec2>>(get, set, destination, time, method);
   m_pImpl->m_offsetTo.function = std::move(offsetTo);
   m_pImpl->m_offsetTo.isEnabled = true;
@@ -291,7 +344,10 @@ void Entity::offsetTo(glm::vec2 destination, ngf::TimeSpan time, InterpolationMe
 
 void Entity::moveTo(glm::vec2 destination, ngf::TimeSpan time, InterpolationMethod method) {
   auto get = [this] { return m_pImpl->m_transform.getPosition(); };
-  auto set = [this](const glm::vec2 &value) { m_pImpl->m_transform.setPosition(value); };
+  auto set = [this](const glm::vec2 &value) {
+    m_pImpl->m_transform.setPosition(value);
+    onTransformChanged();
+  };
   auto moveTo = std::make_unique<ChangeProperty<glm::vec2>>(get, set, destination, time, method);
   m_pImpl->m_moveTo.function = std::move(moveTo);
   m_pImpl->m_moveTo.isEnabled = true;
@@ -299,7 +355,10 @@ void Entity::moveTo(glm::vec2 destination, ngf::TimeSpan time, InterpolationMeth
 
 void Entity::rotateTo(float destination, ngf::TimeSpan time, InterpolationMethod method) {
   auto get = [this] { return m_pImpl->m_transform.getRotation(); };
-  auto set = [this](const float &value) { m_pImpl->m_transform.setRotation(value); };
+  auto set = [this](const float &value) {
+    m_pImpl->m_transform.setRotation(value);
+    onTransformChanged();
+  };
   auto rotateTo =
       std::make_unique<ChangeProperty<float>>(get, set, destination, time, method);
   m_pImpl->m_rotateTo.function = std::move(rotateTo);
@@ -308,7 +367,10 @@ void Entity::rotateTo(float destination, ngf::TimeSpan time, InterpolationMethod
 
 void Entity::scaleTo(float destination, ngf::TimeSpan time, InterpolationMethod method) {
   auto get = [this] { return m_pImpl->m_transform.getScale().x; };
-  auto set = [this](const float &s) { m_pImpl->m_transform.setScale({s, s}); };
+  auto set = [this](const float &s) {
+    m_pImpl->m_transform.setScale({s, s});
+    onTransformChanged();
+  };
   auto scalteTo = std::make_unique<ChangeProperty<float>>(get, set, destination, time, method);
   m_pImpl->m_scaleTo.function = std::move(scalteTo);
   m_pImpl->m_scaleTo.isEnabled = true;
@@ -71,15 +71,19 @@ struct Object::Impl {
 
 Object::Object() : pImpl(std::make_unique<Impl>()) {
   m_id = Locator<EntityManager>::get().getObjectId();
+  Locator<EntityManager>::get().addScriptObject(this);
   ScriptEngine::set(this, "_id", m_id);
 }
 
 Object::Object(HSQOBJECT obj) : pImpl(std::make_unique<Impl>(obj)) {
   m_id = Locator<EntityManager>::get().getObjectId();
+  Locator<EntityManager>::get().addScriptObject(this);
   ScriptEngine::set(this, "_id", m_id);
 }
 
-Object::~Object() = default;
+Object::~Object() {
+  Locator<EntityManager>::get().removeScriptObject(this);
+}
 
 void Object::setZOrder(int zorder) { pImpl->zorder = zorder; }
 
@@ -88,7 +92,10 @@ int Object::getZOrder() const { return pImpl->zorder; }
 void Object::setType(ObjectType type) { pImpl->type = type; }
 ObjectType Object::getType() const { return pImpl->type; }
 
-void Object::setHotspot(const ngf::irect &hotspot) { pImpl->hotspot = hotspot; }
+void Object::setHotspot(const ngf::irect &hotspot) {
+  pImpl->hotspot = hotspot;
+  onTransformChanged();
+}
 ngf::irect Object::getHotspot() const { return pImpl->hotspot; }
 
 void Object::setIcon(const std::string &icon) {
@@ -155,6 +162,12 @@ Room *Object::getRoom() { return pImpl->pRoom; }
 const Room *Object::getRoom() const { return pImpl->pRoom; }
 void Object::setRoom(Room *pRoom) { pImpl->pRoom = pRoom; }
 
+void Object::onTransformChanged() {
+  if (pImpl->pRoom) {
+    pImpl->pRoom->invalidateHotspot(*this);
+  }
+}
+
 void Object::addTrigger(const std::shared_ptr<Trigger> &trigger) { pImpl->trigger = trigger; }
 
 void Object::removeTrigger() {
@@ -91,13 +91,10 @@ void TalkingState::draw(ngf::RenderTarget &target, ngf::RenderStates) const {
                                                                   PreferenceDefaultValues::RetroFonts);
   auto &font = m_pEngine->getResourceManager().getFont(retroFonts ? "FontRetroSheet" : "FontModernSheet");
 
-  ng::Text text;
-  text.setMaxWidth(static_cast<int>((Screen::Width * 3) / 4));
-  text.setFont(font);
-  text.setColor(m_talkColor);
-  text.setWideString(m_sayText);
+  m_text.setLayout(m_sayText, font, static_cast<int>((Screen::Width * 3) / 4));
+  m_text.updateColor(m_talkColor);
 
-  auto bounds = text.getLocalBounds();
+  auto bounds = m_text.getLocalBounds();
   auto pos = m_transform.getPosition();
 
   if ((pos.x + bounds.getWidth() / 2) > (Screen::Width - 20)) {
@@ -114,8 +111,8 @@ void TalkingState::draw(ngf::RenderTarget &target, ngf::RenderStates) const {
   } else {
     pos.y = pos.y - bounds.getHeight();
   }
-  text.getTransform().setPosition(pos);
-  text.draw(target, {});
+  m_text.getTransform().setPosition(pos);
+  m_text.draw(target, {});
 
 // sf::RectangleShape shape;
 // shape.setFillColor(sf::Color::Transparent);
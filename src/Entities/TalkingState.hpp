@@ -3,6 +3,7 @@
 #include <engge/Engine/Engine.hpp>
 #include <engge/Engine/EntityManager.hpp>
 #include <engge/Graphics/GGFont.hpp>
+#include <engge/Graphics/Text.hpp>
 #include <engge/Graphics/Screen.hpp>
 #include <engge/Scripting/ScriptEngine.hpp>
 #include <engge/Audio/SoundId.hpp>
@@ -53,5 +54,6 @@ private:
   int m_soundId{0};
   std::vector<std::tuple<int, std::string, bool>> m_ids;
   ngf::Transform m_transform;
+  mutable ng::Text m_text;
 };
 }
\ No newline at end of file
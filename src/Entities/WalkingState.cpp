@@ -8,6 +8,11 @@ namespace ng {
 void WalkingState::setActor(Actor *pActor) { m_pActor = pActor; }
 
 void WalkingState::setDestination(const std::vector <glm::vec2> &path, std::optional <Facing> facing) {
+  m_pendingPath = {};
+  m_hasSupersededWalk = false;
+  if (ScriptEngine::rawExists(m_pActor, "preWalking")) {
+    ScriptEngine::rawCall(m_pActor, "preWalking");
+  }
   m_path = path;
   m_facing = facing;
   m_path.erase(m_path.begin());
@@ -19,7 +24,49 @@ void WalkingState::setDestination(const std::vector <glm::vec2> &path, std::opti
   trace("{} go to : {},{}", m_pActor->getName(), m_path[0].x, m_path[0].y);
 }
 
+void WalkingState::setDestination(std::shared_future<std::vector<glm::vec2>> path, std::optional<Facing> facing) {
+  // the current walk is superseded: the actor waits where it is until the new path is ready
+  if (m_isWalking) {
+    m_isWalking = false;
+    m_hasSupersededWalk = true;
+  }
+  m_pendingPath = std::move(path);
+  m_pendingFacing = facing;
+  m_pPendingRoom = m_pActor->getRoom();
+}
+
+void WalkingState::setPathCallback(std::function<void(const std::vector<glm::vec2> &)> callback) {
+  m_pathCallback = std::move(callback);
+}
+
+void WalkingState::updatePendingPath() {
+  if (m_pendingPath.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+    return;
+
+  auto path = m_pendingPath.get();
+  m_pendingPath = {};
+  // the path is obsolete if the actor has changed of room in the meantime
+  if (m_pPendingRoom != m_pActor->getRoom() || path.size() < 2) {
+    // the actor was walking before this path was requested, it stops now
+    if (m_hasSupersededWalk) {
+      m_hasSupersededWalk = false;
+      endWalk();
+    }
+    return;
+  }
+  if (m_pathCallback) {
+    m_pathCallback(path);
+  }
+  setDestination(path, m_pendingFacing);
+}
+
 void WalkingState::stop() {
+  m_pendingPath = {};
+  m_hasSupersededWalk = false;
+  endWalk();
+}
+
+void WalkingState::endWalk() {
   m_isWalking = false;
   m_pActor->getCostume().setStandState();
   if (ScriptEngine::rawExists(m_pActor, "postWalking")) {
@@ -37,6 +84,9 @@ Facing WalkingState::getFacing() {
 }
 
 void WalkingState::update(const ngf::TimeSpan &elapsed) {
+  if (m_pendingPath.valid()) {
+    updatePendingPath();
+  }
   if (!m_isWalking)
     return;
 
@@ -68,7 +118,7 @@ void WalkingState::update(const ngf::TimeSpan &elapsed) {
   }
 
   // the actor is arrived to the final destination
-  stop();
+  endWalk();
   trace("Play anim stand");
   if (m_facing.has_value()) {
     m_pActor->getCostume().setFacing(m_facing.value());
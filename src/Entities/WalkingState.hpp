@@ -1,4 +1,6 @@
 #pragma once
+#include <functional>
+#include <future>
 #include <optional>
 #include <vector>
 #include <glm/vec2.hpp>
@@ -7,18 +9,26 @@
 
 namespace ng {
 class Actor;
+class Room;
 
 class WalkingState final {
 public:
   void setActor(Actor *pActor);
   void setDestination(const std::vector<glm::vec2> &path, std::optional<Facing> facing);
+  /// Sets the destination with a path which is being calculated, the actor starts
+  /// to walk in the first update where the path is ready.
+  void setDestination(std::shared_future<std::vector<glm::vec2>> path, std::optional<Facing> facing);
+  /// Sets the function called when a path calculated in background is applied.
+  void setPathCallback(std::function<void(const std::vector<glm::vec2> &)> callback);
   void update(const ngf::TimeSpan &elapsed);
   void stop();
 
-  [[nodiscard]] inline bool isWalking() const { return m_isWalking; }
+  [[nodiscard]] inline bool isWalking() const { return m_isWalking || m_pendingPath.valid(); }
 
 private:
   Facing getFacing();
+  void updatePendingPath();
+  void endWalk();
 
 private:
   Actor *m_pActor{nullptr};
@@ -27,5 +37,10 @@ private:
   bool m_isWalking{false};
   glm::vec2 m_init{0, 0};
   ngf::TimeSpan m_elapsed;
+  std::shared_future<std::vector<glm::vec2>> m_pendingPath;
+  std::optional<Facing> m_pendingFacing;
+  const Room *m_pPendingRoom{nullptr};
+  bool m_hasSupersededWalk{false};
+  std::function<void(const std::vector<glm::vec2> &)> m_pathCallback;
 };
 }
\ No newline at end of file
@@ -20,11 +20,13 @@ void AnimDrawable::draw(const glm::vec2 &pos, ngf::RenderTarget &target, ngf::Re
   if (m_anim->frames.empty() && m_anim->layers.empty())
     return;
 
+  // the frame and its layers usually share the same sheet: batch them
   draw(pos, *m_anim, target, states);
 
   for (const auto &layer : m_anim->layers) {
     draw(pos, layer, target, states);
   }
+  m_batch.flush(target);
 }
 
 void AnimDrawable::draw(const glm::vec2 &pos,
@@ -58,15 +60,25 @@ void AnimDrawable::draw(const glm::vec2 &pos,
   tFlipX.setScale({m_flipX ? -1 : 1, 1});
   states.transform = tFlipX.getTransform() * t.getTransform() * states.transform;
 
-  auto pShader = (LightingShader *) states.shader;
   auto texture = Locator<ResourceManager>::get().getTexture(anim.texture);
   if (!texture)
     return;
 
+  if (SpriteBatch::canBatch(states)) {
+    m_batch.draw(target, *texture, frame.frame, m_color, states);
+    return;
+  }
+
+  m_batch.flush(target);
+  auto pShader = (LightingShader *) states.shader;
   auto texSize = texture->getSize();
+  glm::vec2 spriteOffset{-frame.frame.getWidth() / 2.f + pos.x, -frame.frame.getHeight() / 2.f - pos.y};
+  // the bounds of the sprite in the space where the shader computes the lighting
+  pShader->cullLights(ngf::frect::fromMinMax({spriteOffset.x, -spriteOffset.y - frame.frame.getHeight()},
+                                             {spriteOffset.x + frame.frame.getWidth(), -spriteOffset.y}));
   pShader->setTexture(*texture);
   pShader->setContentSize(frame.sourceSize);
-  pShader->setSpriteOffset({-frame.frame.getWidth() / 2.f + pos.x, -frame.frame.getHeight() / 2.f - pos.y});
+  pShader->setSpriteOffset(spriteOffset);
   pShader->setSpritePosInSheet({static_cast<float>(frame.frame.min.x) / texSize.x,
                                 static_cast<float>(frame.frame.min.y) / texSize.y});
   pShader->setSpriteSizeRelToSheet({static_cast<float>(frame.sourceSize.x) / texSize.x,
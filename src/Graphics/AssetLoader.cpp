@@ -0,0 +1,60 @@
+#include <algorithm>
+#include "engge/Graphics/AssetLoader.hpp"
+
+namespace ng {
+AssetLoader::AssetLoader(std::size_t numWorkers) {
+  numWorkers = std::max<std::size_t>(numWorkers, 1);
+  for (std::size_t i = 0; i < numWorkers; ++i) {
+    m_workers.emplace_back([this] { run(); });
+  }
+}
+
+AssetLoader::~AssetLoader() {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_isStopping = true;
+    m_jobs.clear();
+  }
+  m_condition.notify_all();
+  for (auto &worker : m_workers) {
+    worker.join();
+  }
+}
+
+std::size_t AssetLoader::getDefaultWorkerCount() {
+  // keep one core for the main thread, reading the packs is serialized anyway
+  auto count = static_cast<std::size_t>(std::thread::hardware_concurrency());
+  return std::clamp<std::size_t>(count > 1 ? count - 1 : 1, 1, 4);
+}
+
+std::shared_future<void> AssetLoader::enqueue(std::function<void()> job) {
+  std::packaged_task<void()> task(std::move(job));
+  auto future = task.get_future().share();
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_jobs.push_back(std::move(task));
+  }
+  m_condition.notify_one();
+  return future;
+}
+
+std::size_t AssetLoader::getPendingJobCount() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_jobs.size();
+}
+
+void AssetLoader::run() {
+  while (true) {
+    std::packaged_task<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_condition.wait(lock, [this] { return m_isStopping || !m_jobs.empty(); });
+      if (m_isStopping)
+        return;
+      task = std::move(m_jobs.front());
+      m_jobs.pop_front();
+    }
+    task();
+  }
+}
+} // namespace ng
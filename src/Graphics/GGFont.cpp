@@ -23,11 +23,7 @@ void GGFont::setTextureManager(ResourceManager *textureManager) {
 }
 
 void GGFont::load(const std::string &path) {
-  m_path = path + ".png";
-  m_jsonFilename = path + ".json";
-
-  auto buffer = Locator<EngineSettings>::get().readBuffer(m_jsonFilename);
-  m_json = ngf::Json::parse(buffer.data());
+  auto buffer = Locator<EngineSettings>::get().readBuffer(path + ".json");
 
 #if 0
   std::ofstream o;
@@ -36,6 +32,14 @@ void GGFont::load(const std::string &path) {
   o.close();
 #endif
 
+  load(path, ngf::Json::parse(buffer.data()));
+}
+
+void GGFont::load(const std::string &path, ngf::GGPackValue json) {
+  m_path = path + ".png";
+  m_jsonFilename = path + ".json";
+  m_json = std::move(json);
+
   m_texture = m_resourceManager->getTexture(m_path);
 
   for (const auto &jFrame : m_json["frames"].items()) {
@@ -100,24 +100,37 @@ LightingShader::LightingShader() {
   load(vertexShaderCode, fragmentShaderCode);
 }
 
+template<typename T>
+bool LightingShader::update(std::optional<T> &cachedValue, const T &value) {
+  if (cachedValue.has_value() && *cachedValue == value)
+    return false;
+  cachedValue = value;
+  return true;
+}
+
 void LightingShader::setContentSize(glm::vec2 size) {
-  setUniform("u_contentSize", size);
+  if (update(m_contentSize, size))
+    setUniform("u_contentSize", size);
 }
 
 void LightingShader::setSpritePosInSheet(glm::vec2 spritePosInSheet) {
-  setUniform("u_spritePosInSheet", spritePosInSheet);
+  if (update(m_spritePosInSheet, spritePosInSheet))
+    setUniform("u_spritePosInSheet", spritePosInSheet);
 }
 
 void LightingShader::setSpriteSizeRelToSheet(glm::vec2 spriteSizeRelToSheet) {
-  setUniform("u_spriteSizeRelToSheet", spriteSizeRelToSheet);
+  if (update(m_spriteSizeRelToSheet, spriteSizeRelToSheet))
+    setUniform("u_spriteSizeRelToSheet", spriteSizeRelToSheet);
 }
 
 void LightingShader::setSpriteOffset(glm::vec2 spriteOffset) {
-  setUniform("u_spriteOffset", spriteOffset);
+  if (update(m_spriteOffset, spriteOffset))
+    setUniform("u_spriteOffset", spriteOffset);
 }
 
 void LightingShader::setAmbientColor(ngf::Color color) {
-  setUniform3("u_ambientColor", color);
+  if (update(m_ambientColor, glm::vec3(color.r, color.g, color.b)))
+    setUniform3("u_ambientColor", color);
   m_ambient = color;
 }
 
@@ -128,46 +141,101 @@ void LightingShader::setTexture(const ngf::Texture &texture) {
 }
 
 void LightingShader::setNumberLights(int numberLights) {
-  setUniform("u_numberLights", numberLights);
+  if (update(m_numberLightsUniform, numberLights))
+    setUniform("u_numberLights", numberLights);
   m_numberLights = std::min(numberLights, LightingShader::MaxLights);
 }
 
 int LightingShader::getNumberLights() const { return m_numberLights; }
 
 void LightingShader::setLights(const std::array<Light, MaxLights> &lights) {
+  m_lights.clear();
+  for (int i = 0; i < m_numberLights; ++i) {
+    auto &light = lights[i];
+    if (!light.on)
+      continue;
+    auto direction = light.coneDirection - 90.f;
+    LightData data{};
+    data.coneDirection = glm::vec2(std::cos(glm::radians(direction)), std::sin(glm::radians(direction)));
+    data.coneCosineHalfConeAngle = cos(glm::radians(light.coneAngle / 2.f));
+    data.coneFalloff = light.coneFalloff;
+    data.color = glm::vec3(light.color.r, light.color.g, light.color.b);
+    data.pos = glm::vec3(light.pos, 1.f);
+    data.brightness = light.brightness;
+    data.cutoffRadius = std::max(1.0f, light.cutOffRadius);
+    data.halfRadius = std::max(0.01f, std::min(0.99f, light.halfRadius));
+    m_lights.push_back(data);
+  }
+  m_numberLights = static_cast<int>(m_lights.size());
+
+  std::array<int, MaxLights> indices{};
+  for (int i = 0; i < m_numberLights; ++i) {
+    indices[i] = i;
+  }
+  uploadLights(indices, m_numberLights);
+}
+
+void LightingShader::cullLights(const ngf::frect &bounds) {
+  if (m_numberLights == 0)
+    return;
+
+  // a light has no effect beyond its cutoff radius
+  std::array<int, MaxLights> indices{};
+  int count = 0;
+  for (size_t i = 0; i < m_lights.size(); ++i) {
+    const auto &light = m_lights[i];
+    glm::vec2 pos(light.pos);
+    auto closest = glm::clamp(pos, bounds.min, bounds.max);
+    auto delta = pos - closest;
+    if (glm::dot(delta, delta) < light.cutoffRadius * light.cutoffRadius) {
+      indices[count++] = static_cast<int>(i);
+    }
+  }
+  uploadLights(indices, count);
+  if (update(m_numberLightsUniform, count))
+    setUniform("u_numberLights", count);
+}
+
+void LightingShader::uploadLights(const std::array<int, MaxLights> &indices, int count) {
   std::array<glm::vec3, MaxLights> u_lightPos{};
   std::array<glm::vec2, MaxLights> u_coneDirection{};
   std::array<float, MaxLights> u_coneCosineHalfConeAngle{};
   std::array<float, MaxLights> u_coneFalloff{};
-  std::array<ngf::Color, MaxLights> u_lightColor;
+  std::array<glm::vec3, MaxLights> u_lightColor{};
   std::array<float, MaxLights> u_brightness{};
   std::array<float, MaxLights> u_cutoffRadius{};
   std::array<float, MaxLights> u_halfRadius{};
 
   int numLights = 0;
-  for (int i = 0; i < m_numberLights; ++i) {
-    auto &light = lights[i];
-    if (!light.on)
-      continue;
-    auto direction = light.coneDirection - 90.f;
-    u_coneDirection[numLights] = glm::vec2(std::cos(glm::radians(direction)), std::sin(glm::radians(direction)));
-    u_coneCosineHalfConeAngle[numLights] = cos(glm::radians(light.coneAngle / 2.f));
+  for (int i = 0; i < count; ++i) {
+    const auto &light = m_lights[indices[i]];
+    u_coneDirection[numLights] = light.coneDirection;
+    u_coneCosineHalfConeAngle[numLights] = light.coneCosineHalfConeAngle;
     u_coneFalloff[numLights] = light.coneFalloff;
     u_lightColor[numLights] = light.color;
-    u_lightPos[numLights] = glm::vec3(light.pos, 1.f);
+    u_lightPos[numLights] = light.pos;
     u_brightness[numLights] = light.brightness;
-    u_cutoffRadius[numLights] = std::max(1.0f, light.cutOffRadius);
-    u_halfRadius[numLights] = std::max(0.01f, std::min(0.99f, light.halfRadius));
+    u_cutoffRadius[numLights] = light.cutoffRadius;
+    u_halfRadius[numLights] = light.halfRadius;
     numLights++;
   }
-  m_numberLights = numLights;
-  setUniformArray("u_lightPos", u_lightPos.data(), MaxLights);
-  setUniformArray("u_coneDirection", u_coneDirection.data(), MaxLights);
-  setUniformArray("u_coneCosineHalfConeAngle", u_coneCosineHalfConeAngle.data(), MaxLights);
-  setUniformArray("u_coneFalloff", u_coneFalloff.data(), MaxLights);
-  setUniformArray3("u_lightColor", u_lightColor.data(), MaxLights);
-  setUniformArray("u_brightness", u_brightness.data(), MaxLights);
-  setUniformArray("u_cutoffRadius", u_cutoffRadius.data(), MaxLights);
-  setUniformArray("u_halfRadius", u_halfRadius.data(), MaxLights);
+
+  // the lights rarely change: only upload the arrays which have been modified
+  if (update(m_lightPos, u_lightPos))
+    setUniformArray("u_lightPos", u_lightPos.data(), MaxLights);
+  if (update(m_lightConeDirection, u_coneDirection))
+    setUniformArray("u_coneDirection", u_coneDirection.data(), MaxLights);
+  if (update(m_lightConeCosineHalfConeAngle, u_coneCosineHalfConeAngle))
+    setUniformArray("u_coneCosineHalfConeAngle", u_coneCosineHalfConeAngle.data(), MaxLights);
+  if (update(m_lightConeFalloff, u_coneFalloff))
+    setUniformArray("u_coneFalloff", u_coneFalloff.data(), MaxLights);
+  if (update(m_lightColor, u_lightColor))
+    setUniformArray("u_lightColor", u_lightColor.data(), MaxLights);
+  if (update(m_lightBrightness, u_brightness))
+    setUniformArray("u_brightness", u_brightness.data(), MaxLights);
+  if (update(m_lightCutoffRadius, u_cutoffRadius))
+    setUniformArray("u_cutoffRadius", u_cutoffRadius.data(), MaxLights);
+  if (update(m_lightHalfRadius, u_halfRadius))
+    setUniformArray("u_halfRadius", u_halfRadius.data(), MaxLights);
 }
 }
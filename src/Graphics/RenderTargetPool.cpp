@@ -0,0 +1,33 @@
+#include <algorithm>
+#include "RenderTargetPool.hpp"
+
+namespace ng {
+ngf::RenderTexture &RenderTargetPool::acquire(glm::ivec2 size) {
+  auto it = std::find_if(m_targets.begin(), m_targets.end(), [size](const auto &target) {
+    return !target.isUsed && target.size == size;
+  });
+  if (it == m_targets.end()) {
+    // the window has been resized: recreate a free target with the new size
+    it = std::find_if(m_targets.begin(), m_targets.end(), [](const auto &target) { return !target.isUsed; });
+    if (it == m_targets.end()) {
+      m_targets.emplace_back();
+      it = std::prev(m_targets.end());
+    }
+    it->texture = std::make_unique<ngf::RenderTexture>(size);
+    it->size = size;
+  }
+  it->isUsed = true;
+  it->wasUsed = true;
+  return *it->texture;
+}
+
+void RenderTargetPool::newFrame() {
+  m_targets.erase(std::remove_if(m_targets.begin(), m_targets.end(), [](const auto &target) {
+    return !target.wasUsed;
+  }), m_targets.end());
+  for (auto &target : m_targets) {
+    target.isUsed = false;
+    target.wasUsed = false;
+  }
+}
+} // namespace ng
@@ -0,0 +1,30 @@
+#pragma once
+#include <memory>
+#include <vector>
+#include <glm/vec2.hpp>
+#include <ngf/Graphics/RenderTexture.h>
+
+namespace ng {
+/// @brief Keeps render textures alive between frames to avoid to allocate a framebuffer
+/// and its texture for each post-processing pass.
+class RenderTargetPool {
+public:
+  /// Gets a render texture of the given size which is not used in this frame.
+  /// The render texture is reused from a previous frame if possible.
+  ngf::RenderTexture &acquire(glm::ivec2 size);
+  /// Destroys the render textures not used during the previous frame
+  /// and makes the others available for the new frame.
+  void newFrame();
+
+  [[nodiscard]] size_t getSize() const { return m_targets.size(); }
+
+private:
+  struct Target {
+    std::unique_ptr<ngf::RenderTexture> texture;
+    glm::ivec2 size{0, 0};
+    bool isUsed{false};
+    bool wasUsed{false};
+  };
+  std::vector<Target> m_targets;
+};
+} // namespace ng
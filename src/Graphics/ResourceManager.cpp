@@ -1,4 +1,6 @@
+#include <algorithm>
 #include "engge/Engine/EngineSettings.hpp"
+#include "engge/Engine/Preferences.hpp"
 #include "engge/Graphics/GGFont.hpp"
 #include "engge/System/Locator.hpp"
 #include "engge/System/Logger.hpp"
@@ -6,14 +8,52 @@
 #include "engge/Graphics/SpriteSheet.hpp"
 #include <ngf/Graphics/FntFont.h>
 #include <ngf/IO/MemoryStream.h>
+#include <ngf/IO/Json/JsonParser.h>
 
 namespace ng {
-ResourceManager::ResourceManager() = default;
+ResourceManager::ResourceManager() {
+  readMemoryBudget();
+  Locator<Preferences>::get().subscribe([this](const std::string &name) {
+    if (name == PreferenceNames::EnggeTextureBudget || name == PreferenceNames::EnggeSpriteSheetBudget) {
+      readMemoryBudget();
+    }
+  });
+}
+
 ResourceManager::~ResourceManager() = default;
 
+void ResourceManager::readMemoryBudget() {
+  const auto &preferences = Locator<Preferences>::get();
+  auto textureBudget = preferences.getUserPreference(PreferenceNames::EnggeTextureBudget,
+                                                     PreferenceDefaultValues::EnggeTextureBudget);
+  auto spriteSheetBudget = preferences.getUserPreference(PreferenceNames::EnggeSpriteSheetBudget,
+                                                         PreferenceDefaultValues::EnggeSpriteSheetBudget);
+  setMemoryBudget(static_cast<size_t>(std::max(textureBudget, 1)) * 1024 * 1024,
+                  static_cast<size_t>(std::max(spriteSheetBudget, 1)) * 1024 * 1024);
+}
+
+void ResourceManager::setMemoryBudget(size_t textureBytes, size_t spriteSheetBytes) {
+  m_textureBudget = textureBytes;
+  m_spriteSheetBudget = spriteSheetBytes;
+}
+
+void ResourceManager::addTexture(const std::string &id, const ngf::Image &image) {
+  auto texture = std::make_shared<ngf::Texture>(image);
+  auto textureSize = texture->getSize();
+  auto size = static_cast<size_t>(textureSize.x) * static_cast<size_t>(textureSize.y) * 4;
+  m_textureMap.insert(std::make_pair(id, TextureResource{texture, size, m_frame}));
+  m_stats.textureBytes += size;
+}
+
+void ResourceManager::addSpriteSheet(const std::string &id, std::shared_ptr<SpriteSheet> spriteSheet) {
+  auto size = spriteSheet->getMemorySize();
+  m_spriteSheetMap.insert(std::make_pair(id, SpriteSheetResource{std::move(spriteSheet), size, m_frame}));
+  m_stats.spriteSheetBytes += size;
+}
+
 void ResourceManager::load(const std::string &id) {
   info("Load texture {}", id);
-  auto data = Locator<EngineSettings>::get().readBuffer(id);
+  auto data = Locator<EngineSettings>::get().readView(id);
 
 #if 0
   std::ofstream os(path, std::ios::out|std::ios::binary);
@@ -25,9 +65,7 @@ void ResourceManager::load(const std::string &id) {
   if (!img.loadFromMemory(data.data(), data.size())) {
     error("Fail to load texture {}", id);
   }
-
-  auto texture = std::make_shared<ngf::Texture>(img);
-  m_textureMap.insert(std::make_pair(id, TextureResource{texture, data.size()}));
+  addTexture(id, img);
 }
 
 void ResourceManager::loadFont(const std::string &id) {
@@ -42,7 +80,7 @@ void ResourceManager::loadFntFont(const std::string &id) {
   info("Load Fnt font {}", id);
   auto font = std::make_shared<ngf::FntFont>();
 
-  auto data = Locator<EngineSettings>::get().readBuffer(id);
+  auto data = Locator<EngineSettings>::get().readView(id);
   ngf::MemoryStream ms(data.data(), data.data() + data.size());
   font->load(id, ms, [](auto name) {
     return Locator<ResourceManager>::get().getTexture(name.string());
@@ -56,22 +94,40 @@ void ResourceManager::loadSpriteSheet(const std::string &id) {
   auto spriteSheet = std::make_shared<SpriteSheet>();
   spriteSheet->setTextureManager(this);
   spriteSheet->load(id);
-  m_spriteSheetMap.insert(std::make_pair(id, spriteSheet));
+  addSpriteSheet(id, spriteSheet);
 }
 
 std::shared_ptr<ngf::Texture> ResourceManager::getTexture(const std::string &id) {
   auto found = m_textureMap.find(id);
-  if (found == m_textureMap.end()) {
-    load(id);
+  if (found != m_textureMap.end()) {
+    ++m_stats.hits;
+  } else {
+    ++m_stats.misses;
+    auto pending = m_pendingTextures.find(id);
+    if (pending != m_pendingTextures.end()) {
+      auto pendingLoad = pending->second;
+      m_pendingTextures.erase(pending);
+      finishTexture(id, pendingLoad);
+    } else {
+      load(id);
+    }
     found = m_textureMap.find(id);
   }
+  found->second.lastUsedFrame = m_frame;
   return found->second.texture;
 }
 
 GGFont &ResourceManager::getFont(const std::string &id) {
   auto found = m_fontMap.find(id);
   if (found == m_fontMap.end()) {
-    loadFont(id);
+    auto pending = m_pendingFonts.find(id);
+    if (pending != m_pendingFonts.end()) {
+      auto pendingLoad = pending->second;
+      m_pendingFonts.erase(pending);
+      finishFont(id, pendingLoad);
+    } else {
+      loadFont(id);
+    }
     found = m_fontMap.find(id);
   }
   return *found->second;
@@ -88,11 +144,189 @@ ngf::FntFont &ResourceManager::getFntFont(const std::string &id) {
 
 const SpriteSheet &ResourceManager::getSpriteSheet(const std::string &id) {
   auto found = m_spriteSheetMap.find(id);
-  if (found == m_spriteSheetMap.end()) {
-    loadSpriteSheet(id);
+  if (found != m_spriteSheetMap.end()) {
+    ++m_stats.hits;
+  } else {
+    ++m_stats.misses;
+    auto pending = m_pendingSpriteSheets.find(id);
+    if (pending != m_pendingSpriteSheets.end()) {
+      auto pendingLoad = pending->second;
+      m_pendingSpriteSheets.erase(pending);
+      finishSpriteSheet(id, pendingLoad);
+    } else {
+      loadSpriteSheet(id);
+    }
     found = m_spriteSheetMap.find(id);
   }
-  return *found->second;
+  found->second.lastUsedFrame = m_frame;
+  return *found->second.spriteSheet;
+}
+
+std::shared_future<void> ResourceManager::makeReadyFuture() {
+  std::promise<void> promise;
+  promise.set_value();
+  return promise.get_future().share();
+}
+
+std::shared_future<void> ResourceManager::loadTextureAsync(const std::string &id) {
+  if (m_textureMap.find(id) != m_textureMap.end())
+    return makeReadyFuture();
+
+  auto pending = m_pendingTextures.find(id);
+  if (pending != m_pendingTextures.end())
+    return pending->second.future;
+
+  auto data = std::make_shared<DecodedTexture>();
+  auto future = m_loader.enqueue([id, data] {
+    auto buffer = Locator<EngineSettings>::get().readView(id);
+    data->size = buffer.size();
+    data->isValid = data->image.loadFromMemory(buffer.data(), buffer.size());
+  });
+  m_pendingTextures.insert(std::make_pair(id, PendingLoad<DecodedTexture>{future, data}));
+  return future;
+}
+
+std::shared_future<void> ResourceManager::loadFontAsync(const std::string &id) {
+  if (m_fontMap.find(id) != m_fontMap.end())
+    return makeReadyFuture();
+
+  auto pending = m_pendingFonts.find(id);
+  if (pending != m_pendingFonts.end())
+    return pending->second.future;
+
+  loadTextureAsync(id + ".png");
+  auto data = std::make_shared<ngf::GGPackValue>();
+  auto future = m_loader.enqueue([id, data] {
+    auto buffer = Locator<EngineSettings>::get().readBuffer(id + ".json");
+    *data = ngf::Json::parse(buffer.data());
+  });
+  m_pendingFonts.insert(std::make_pair(id, PendingLoad<ngf::GGPackValue>{future, data}));
+  return future;
+}
+
+std::shared_future<void> ResourceManager::loadSpriteSheetAsync(const std::string &id) {
+  if (m_spriteSheetMap.find(id) != m_spriteSheetMap.end())
+    return makeReadyFuture();
+
+  auto pending = m_pendingSpriteSheets.find(id);
+  if (pending != m_pendingSpriteSheets.end())
+    return pending->second.future;
+
+  loadTextureAsync(id + ".png");
+  auto spriteSheet = std::make_shared<SpriteSheet>();
+  spriteSheet->setTextureManager(this);
+  auto future = m_loader.enqueue([id, spriteSheet] {
+    spriteSheet->load(id);
+  });
+  m_pendingSpriteSheets.insert(std::make_pair(id, PendingLoad<SpriteSheet>{future, spriteSheet}));
+  return future;
+}
+
+void ResourceManager::finishTexture(const std::string &id, PendingLoad<DecodedTexture> pending) {
+  // rethrows the exception if the texture has not been found
+  pending.future.get();
+  info("Load texture {}", id);
+  if (!pending.data->isValid) {
+    error("Fail to load texture {}", id);
+  }
+
+  addTexture(id, pending.data->image);
+}
+
+void ResourceManager::finishFont(const std::string &id, PendingLoad<ngf::GGPackValue> pending) {
+  pending.future.get();
+  info("Load font {}", id);
+  auto font = std::make_shared<GGFont>();
+  font->setTextureManager(this);
+  font->load(id, *pending.data);
+  m_fontMap.insert(std::make_pair(id, font));
+}
+
+void ResourceManager::finishSpriteSheet(const std::string &id, PendingLoad<SpriteSheet> pending) {
+  pending.future.get();
+  info("Load SpriteSheet {}", id);
+  addSpriteSheet(id, pending.data);
+}
+
+template<typename TData, typename TFinish>
+static void finishReadyLoads(std::map<std::string, TData> &pendingLoads, TFinish finish) {
+  for (auto it = pendingLoads.begin(); it != pendingLoads.end();) {
+    if (it->second.future.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+      ++it;
+      continue;
+    }
+    auto id = it->first;
+    auto pending = it->second;
+    it = pendingLoads.erase(it);
+    try {
+      finish(id, pending);
+    } catch (std::exception &e) {
+      error("Fail to load {} in background: {}", id, e.what());
+    }
+  }
+}
+
+void ResourceManager::update() {
+  finishReadyLoads(m_pendingTextures, [this](const auto &id, const auto &pending) { finishTexture(id, pending); });
+  finishReadyLoads(m_pendingSpriteSheets,
+                   [this](const auto &id, const auto &pending) { finishSpriteSheet(id, pending); });
+  // fonts need their texture, so they are finished after the textures
+  finishReadyLoads(m_pendingFonts, [this](const auto &id, const auto &pending) { finishFont(id, pending); });
+
+  evictTextures();
+  evictSpriteSheets();
+  ++m_frame;
+}
+
+template<typename TResourceMap, typename TIsReferenced>
+static size_t evictLeastRecentlyUsed(TResourceMap &resources,
+                                     size_t &usedBytes,
+                                     size_t budget,
+                                     size_t frame,
+                                     size_t delayInFrames,
+                                     TIsReferenced isReferenced) {
+  if (usedBytes <= budget)
+    return 0;
+
+  std::vector<typename TResourceMap::iterator> candidates;
+  for (auto it = resources.begin(); it != resources.end(); ++it) {
+    if (isReferenced(it->second) || it->second.lastUsedFrame + delayInFrames > frame)
+      continue;
+    candidates.push_back(it);
+  }
+  std::sort(candidates.begin(), candidates.end(), [](const auto &a, const auto &b) {
+    return a->second.lastUsedFrame < b->second.lastUsedFrame;
+  });
+
+  size_t evictions = 0;
+  for (auto it : candidates) {
+    if (usedBytes <= budget)
+      break;
+    trace("Release resource {}", it->first);
+    usedBytes -= it->second.size;
+    resources.erase(it);
+    ++evictions;
+  }
+  return evictions;
+}
+
+void ResourceManager::evictTextures() {
+  // a texture referenced outside the resource manager (fonts, UI sprites) is still in use
+  m_stats.evictions += evictLeastRecentlyUsed(m_textureMap, m_stats.textureBytes, m_textureBudget, m_frame,
+                                              EvictionDelayInFrames, [](const TextureResource &resource) {
+        return resource.texture.use_count() > 1;
+      });
+}
+
+void ResourceManager::evictSpriteSheets() {
+  m_stats.evictions += evictLeastRecentlyUsed(m_spriteSheetMap, m_stats.spriteSheetBytes, m_spriteSheetBudget,
+                                              m_frame, EvictionDelayInFrames, [](const SpriteSheetResource &resource) {
+        return resource.spriteSheet.use_count() > 1;
+      });
+}
+
+std::size_t ResourceManager::getPendingLoadCount() const {
+  return m_pendingTextures.size() + m_pendingFonts.size() + m_pendingSpriteSheets.size();
 }
 
 } // namespace ng
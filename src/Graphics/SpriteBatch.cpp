@@ -0,0 +1,59 @@
+#include <engge/Graphics/LightingShader.h>
+#include <engge/Graphics/SpriteBatch.hpp>
+
+namespace ng {
+bool SpriteBatch::canBatch(const ngf::RenderStates &states) {
+  // with lights, the shader needs the position of each sprite in its sheet
+  auto pShader = (LightingShader *) states.shader;
+  return !pShader || pShader->getNumberLights() == 0;
+}
+
+void SpriteBatch::draw(ngf::RenderTarget &target,
+                       const ngf::Texture &texture,
+                       const ngf::irect &textureRect,
+                       ngf::Color color,
+                       const ngf::RenderStates &states) {
+  if (m_pTexture != &texture || m_pShader != states.shader) {
+    flush(target);
+    m_pTexture = &texture;
+    m_pShader = states.shader;
+  }
+
+  appendSprite(m_vertices, texture, textureRect, color, states.transform);
+}
+
+void SpriteBatch::appendSprite(std::vector<ngf::Vertex> &vertices,
+                               const ngf::Texture &texture,
+                               const ngf::irect &textureRect,
+                               ngf::Color color,
+                               const glm::mat3 &transform) {
+  auto texSize = glm::vec2(texture.getSize());
+  auto size = glm::vec2(textureRect.getWidth(), textureRect.getHeight());
+  glm::vec2 uvMin = glm::vec2(textureRect.min) / texSize;
+  glm::vec2 uvMax = glm::vec2(textureRect.max) / texSize;
+
+  auto transformPos = [&transform](glm::vec2 pos) {
+    auto p = glm::vec3(pos, 1.f) * transform;
+    return glm::vec2(p.x, p.y);
+  };
+  ngf::Vertex topLeft{transformPos({0, 0}), color, uvMin};
+  ngf::Vertex topRight{transformPos({size.x, 0}), color, {uvMax.x, uvMin.y}};
+  ngf::Vertex bottomLeft{transformPos({0, size.y}), color, {uvMin.x, uvMax.y}};
+  ngf::Vertex bottomRight{transformPos(size), color, uvMax};
+  vertices.insert(vertices.end(), {topLeft, bottomLeft, topRight, topRight, bottomLeft, bottomRight});
+}
+
+void SpriteBatch::flush(ngf::RenderTarget &target) {
+  if (m_vertices.empty())
+    return;
+
+  ngf::RenderStates states;
+  states.shader = m_pShader;
+  states.texture = m_pTexture;
+  if (m_pShader) {
+    ((LightingShader *) m_pShader)->setTexture(*m_pTexture);
+  }
+  target.draw(ngf::PrimitiveType::Triangles, m_vertices, states);
+  m_vertices.clear();
+}
+} // namespace ng
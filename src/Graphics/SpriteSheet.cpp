@@ -1,4 +1,5 @@
 #include <ngf/IO/Json/JsonParser.h>
+#include "engge/Engine/AssetCache.hpp"
 #include "engge/Engine/EngineSettings.hpp"
 #include "engge/System/Locator.hpp"
 #include "../Util/Util.hpp"
@@ -15,10 +16,13 @@ void SpriteSheet::load(const std::string &name) {
   m_spriteSourceSize.clear();
   m_sourceSize.clear();
 
+  auto jsonFilename = name + ".json";
+  if (loadFromCache(jsonFilename))
+    return;
+
   ngf::GGPackValue json;
 
   {
-    auto jsonFilename = name + ".json";
     auto buffer = Locator<EngineSettings>::get().readBuffer(jsonFilename);
 
 #if 0
@@ -39,6 +43,45 @@ void SpriteSheet::load(const std::string &name) {
     auto size = toSize(it.value()["sourceSize"]);
     m_sourceSize.insert(std::make_pair(it.key(), size));
   }
+  saveToCache(jsonFilename);
+}
+
+bool SpriteSheet::loadFromCache(const std::string &entry) {
+  std::vector<char> data;
+  if (!Locator<AssetCache>::get().read("spritesheet", entry, data))
+    return false;
+
+  AssetCacheReader reader(data);
+  auto count = reader.read<uint32_t>();
+  for (uint32_t i = 0; i < count && reader.isValid(); ++i) {
+    auto name = reader.readString<char>();
+    m_rects.insert(std::make_pair(name, reader.read<ngf::irect>()));
+    m_spriteSourceSize.insert(std::make_pair(name, reader.read<ngf::irect>()));
+    m_sourceSize.insert(std::make_pair(name, reader.read<glm::ivec2>()));
+  }
+  if (reader.isValid())
+    return true;
+
+  m_rects.clear();
+  m_spriteSourceSize.clear();
+  m_sourceSize.clear();
+  return false;
+}
+
+void SpriteSheet::saveToCache(const std::string &entry) const {
+  const auto &cache = Locator<AssetCache>::get();
+  if (!cache.isEnabled())
+    return;
+
+  AssetCacheWriter writer;
+  writer.write(static_cast<uint32_t>(m_rects.size()));
+  for (const auto &[name, rect] : m_rects) {
+    writer.writeString(name);
+    writer.write(rect);
+    writer.write(m_spriteSourceSize.at(name));
+    writer.write(m_sourceSize.at(name));
+  }
+  cache.write("spritesheet", entry, writer.getData());
 }
 
 bool SpriteSheet::hasRect(const std::string &name) const {
@@ -65,4 +108,15 @@ glm::ivec2 SpriteSheet::getSourceSize(const std::string &name) const {
   return SpriteSheetItem{name, getRect(name), getSpriteSourceSize(name), getSourceSize(name), false};
 }
 
+size_t SpriteSheet::getMemorySize() const {
+  // each frame is stored in 3 maps: count the keys, the values and the node overhead
+  const size_t nodeSize = 4 * sizeof(void *) + sizeof(std::string);
+  size_t size = sizeof(SpriteSheet) + m_textureName.capacity();
+  for (const auto &rect : m_rects) {
+    size += 3 * (nodeSize + rect.first.capacity());
+    size += 2 * sizeof(ngf::irect) + sizeof(glm::ivec2);
+  }
+  return size;
+}
+
 } // namespace ng
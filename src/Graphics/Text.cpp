@@ -2,12 +2,40 @@
 #include <Engine/DebugFeatures.hpp>
 
 namespace ng {
-Text::Text() {
-  showTextBounds(DebugFeatures::showTextBounds);
+Text::Text() : m_showTextBounds(DebugFeatures::showTextBounds) {
+  showTextBounds(m_showTextBounds);
 }
 
 Text::Text(std::wstring string, const ngf::Font &font, unsigned int characterSize)
-    : ngf::Text(string, font, characterSize) {
-  showTextBounds(DebugFeatures::showTextBounds);
+    : ngf::Text(string, font, characterSize), m_showTextBounds(DebugFeatures::showTextBounds) {
+  showTextBounds(m_showTextBounds);
+}
+
+void Text::setLayout(const std::wstring &string, const ngf::Font &font, int maxWidth) {
+  // the debug tools can change this option at any time
+  if (m_showTextBounds != DebugFeatures::showTextBounds) {
+    m_showTextBounds = DebugFeatures::showTextBounds;
+    showTextBounds(m_showTextBounds);
+  }
+  if (m_pLayoutFont != &font) {
+    m_pLayoutFont = &font;
+    setFont(font);
+  }
+  if (m_layoutMaxWidth != maxWidth) {
+    m_layoutMaxWidth = maxWidth;
+    setMaxWidth(maxWidth);
+  }
+  if (m_layoutString != string) {
+    m_layoutString = string;
+    setWideString(string);
+  }
+}
+
+void Text::updateColor(const ngf::Color &color) {
+  if (m_color.has_value() && m_color->r == color.r && m_color->g == color.g && m_color->b == color.b
+      && m_color->a == color.a)
+    return;
+  m_color = color;
+  setColor(color);
+}
 }
-}
\ No newline at end of file
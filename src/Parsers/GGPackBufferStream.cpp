@@ -8,6 +8,11 @@ void GGPackBufferStream::setBuffer(const std::vector<char> &input) {
   m_offset = 0;
 }
 
+void GGPackBufferStream::setBuffer(std::vector<char> &&input) {
+  m_input = std::move(input);
+  m_offset = 0;
+}
+
 void GGPackBufferStream::read(char *data, size_t size) {
   if ((static_cast<int>(m_offset + size)) > getLength())
     return;
@@ -79,7 +79,7 @@ std::unique_ptr<Ast::Statement> YackParser::parseStatement() {
 }
 
 std::unique_ptr<Ast::Condition> YackParser::parseCondition() {
-  auto text = m_reader.readText(*m_it);
+  auto text = m_reader.getText(*m_it);
   auto conditionText = text.substr(1, text.length() - 2);
   auto line = m_reader.getLine(*m_it++);
   assert(line > 0);
@@ -93,7 +93,7 @@ std::unique_ptr<Ast::Condition> YackParser::parseCondition() {
     return std::make_unique<Ast::TempOnceCondition>(line);
   }
   auto pCondition = std::make_unique<Ast::CodeCondition>(line);
-  pCondition->code = conditionText;
+  pCondition->code = std::string(conditionText);
   return pCondition;
 }
 
@@ -124,9 +124,9 @@ bool YackParser::match(const std::initializer_list<TokenId> &ids) {
 }
 
 std::unique_ptr<Ast::Say> YackParser::parseSayExpression() {
-  auto actor = m_reader.readText(*m_it++);
+  auto actor = m_reader.getText(*m_it++);
   m_it++;
-  auto text = m_reader.readText(*m_it);
+  auto text = m_reader.getText(*m_it);
   m_it++;
   auto pExp = std::make_unique<Ast::Say>();
   pExp->actor = actor;
@@ -135,7 +135,7 @@ std::unique_ptr<Ast::Say> YackParser::parseSayExpression() {
 }
 
 std::unique_ptr<Ast::Expression> YackParser::parseWaitWhileExpression() {
-  auto waitwhile = m_reader.readText(*m_it++);
+  auto waitwhile = m_reader.getText(*m_it++);
   auto code = waitwhile.substr(10);
   auto pExp = std::make_unique<Ast::WaitWhile>();
   pExp->condition = code;
@@ -143,7 +143,7 @@ std::unique_ptr<Ast::Expression> YackParser::parseWaitWhileExpression() {
 }
 
 std::unique_ptr<Ast::Expression> YackParser::parseInstructionExpression() {
-  auto identifier = m_reader.readText(*m_it++);
+  auto identifier = m_reader.getText(*m_it++);
   if (identifier == "shutup") {
     return std::make_unique<Ast::Shutup>();
   } else if (identifier == "pause") {
@@ -164,7 +164,7 @@ std::unique_ptr<Ast::Expression> YackParser::parseInstructionExpression() {
     // parrot [active]
     auto pExp = std::make_unique<Ast::Parrot>();
     if (m_it->id == TokenId::Identifier) {
-      auto active = m_reader.readText(*m_it++);
+      auto active = m_reader.getText(*m_it++);
       pExp->active = active == "yes";
     }
     return pExp;
@@ -188,7 +188,7 @@ std::unique_ptr<Ast::Expression> YackParser::parseInstructionExpression() {
     // allowobjects [allow]
     auto pExp = std::make_unique<Ast::AllowObjects>();
     if (m_it->id == TokenId::Identifier) {
-      auto node = m_reader.readText(*m_it++);
+      auto node = m_reader.getText(*m_it++);
       pExp->allow = node == "YES";
     }
     return pExp;
@@ -201,7 +201,7 @@ std::unique_ptr<Ast::Expression> YackParser::parseInstructionExpression() {
     }
     return pExp;
   }
-  throw std::domain_error("Unknown instruction: " + identifier);
+  throw std::domain_error("Unknown instruction: " + std::string(identifier));
 }
 
 std::unique_ptr<Ast::Goto> YackParser::parseGotoExpression() {
@@ -213,7 +213,7 @@ std::unique_ptr<Ast::Goto> YackParser::parseGotoExpression() {
 }
 
 std::unique_ptr<Ast::Code> YackParser::parseCodeExpression() {
-  auto code = m_reader.readText(*m_it++);
+  auto code = m_reader.getText(*m_it++);
   auto pExp = std::make_unique<Ast::Code>();
   pExp->code = code.substr(1);
   return pExp;
@@ -222,11 +222,8 @@ std::unique_ptr<Ast::Code> YackParser::parseCodeExpression() {
 std::unique_ptr<Ast::Choice> YackParser::parseChoiceExpression() {
   auto number = std::strtol(m_reader.readText(*m_it).data(), nullptr, 10);
   m_it++;
-  std::string text;
-  if (m_it->id == TokenId::Dollar) {
-    text = m_reader.readText(*m_it);
-  } else {
-    text = m_reader.readText(*m_it);
+  auto text = m_reader.getText(*m_it);
+  if (m_it->id != TokenId::Dollar) {
     text = text.substr(1, text.length() - 2);
   }
 
@@ -1,6 +1,8 @@
 #include <algorithm>
+#include <cctype>
 #include "engge/Engine/EngineSettings.hpp"
 #include "engge/Parsers/YackTokenReader.hpp"
+#include "engge/System/Locator.hpp"
 #include "engge/System/Logger.hpp"
 
 namespace ng {
@@ -23,20 +25,15 @@ std::string Token::readToken() const {
   }
 }
 
-YackTokenReader::Iterator::Iterator(YackTokenReader &reader, std::streampos pos)
-    : m_reader(reader),
-      m_pos(pos) {
-  operator++();
-}
-
-YackTokenReader::Iterator::Iterator(const Iterator &it)
-    : m_reader(it.m_reader), m_pos(it.m_pos), m_token(it.m_token) {
+YackTokenReader::Iterator::Iterator(const YackTokenReader &reader, std::size_t index)
+    : m_pReader(&reader), m_index(index) {
 }
 
 YackTokenReader::Iterator &YackTokenReader::Iterator::operator++() {
-  m_reader.m_stream.seek(m_pos);
-  m_reader.readToken(m_token);
-  m_pos = m_reader.m_stream.tell();
+  // the last token is always End, stay on it
+  if (m_index + 1 < m_pReader->m_tokens.size()) {
+    ++m_index;
+  }
   return *this;
 }
 
@@ -46,18 +43,16 @@ YackTokenReader::Iterator YackTokenReader::Iterator::operator++(int) {
   return tmp;
 }
 
-Token &YackTokenReader::Iterator::operator*() {
-  return m_token;
-}
-
 const Token &YackTokenReader::Iterator::operator*() const {
-  return m_token;
+  return m_pReader->m_tokens[m_index];
 }
 
-Token *YackTokenReader::Iterator::operator->() {
-  return &m_token;
+const Token *YackTokenReader::Iterator::operator->() const {
+  return &m_pReader->m_tokens[m_index];
 }
 
+YackTokenReader::YackTokenReader() = default;
+
 void YackTokenReader::load(const std::string &path) {
   auto buffer = Locator<EngineSettings>::get().readBuffer(path);
 
@@ -68,175 +63,155 @@ void YackTokenReader::load(const std::string &path) {
   o.close();
 #endif
 
-  m_stream.setBuffer(buffer);
+  m_buffer = std::move(buffer);
+  tokenize();
 }
 
-YackTokenReader::iterator YackTokenReader::begin() {
+YackTokenReader::iterator YackTokenReader::begin() const {
   return Iterator(*this, 0);
 }
-YackTokenReader::iterator YackTokenReader::end() {
-  auto start = m_stream.tell();
-  m_stream.seek(m_stream.getLength());
-  auto pos = m_stream.tell();
-  m_stream.seek(start);
-  return Iterator(*this, pos);
+
+YackTokenReader::iterator YackTokenReader::end() const {
+  return Iterator(*this, m_tokens.size() - 1);
+}
+
+std::string_view YackTokenReader::getText(const Token &token) const {
+  return std::string_view(m_buffer.data() + token.start, token.end - token.start);
 }
 
-YackTokenReader::YackTokenReader()
-    : m_offset(-1) {
+std::string YackTokenReader::readText(const Token &token) const {
+  return std::string(getText(token));
 }
 
 int YackTokenReader::getLine(const Token &token) const {
-  auto previous = -1;
-  auto previousVal = -1;
-  for (auto &[key, val] : m_lines) {
-    if ((previous < token.start) && (token.start < key)) {
-      return val;
-    }
-    previousVal = val;
-    previous = key;
-  }
-  return previousVal + 1;
+  return token.line;
 }
 
-bool YackTokenReader::readToken(Token &token) {
-  std::streampos start = m_stream.tell();
-  auto id = readTokenId();
-  while (id == TokenId::Whitespace || id == TokenId::Comment || id == TokenId::NewLine || id == TokenId::None) {
-    start = m_stream.tell();
-    id = readTokenId();
-  }
-  std::streampos end = m_stream.tell();
-  token.id = id;
-  token.start = start;
-  token.end = end;
-  return true;
+int YackTokenReader::getLine(std::size_t offset) const {
+  auto it = std::lower_bound(m_lines.cbegin(), m_lines.cend(), offset);
+  return static_cast<int>(std::distance(m_lines.cbegin(), it)) + 1;
 }
 
-std::string YackTokenReader::readText(std::streampos pos, std::streamsize size) {
-  std::string out;
-  out.reserve(size);
-  m_stream.seek(pos);
-  char c;
-  for (int i = 0; i < size; i++) {
-    m_stream.read(&c, 1);
-    out.append(&c, 1);
-  }
-  return out;
+void YackTokenReader::tokenize() {
+  m_tokens.clear();
+  m_lines.clear();
+  m_tokens.reserve(m_buffer.size() / 4);
+
+  std::size_t pos = 0;
+  TokenId id;
+  do {
+    auto start = pos;
+    id = readTokenId(pos);
+    if (id == TokenId::Whitespace || id == TokenId::Comment || id == TokenId::NewLine || id == TokenId::None)
+      continue;
+    // all the new lines before this token have been read
+    m_tokens.push_back({id, start, pos, static_cast<int>(m_lines.size()) + 1});
+  } while (id != TokenId::End);
 }
 
-std::string YackTokenReader::readText(const Token &token) {
-  return readText(token.start, token.end - token.start);
+char YackTokenReader::peek(std::size_t pos) const {
+  return pos < m_buffer.size() ? m_buffer[pos] : '\0';
 }
 
-TokenId YackTokenReader::readTokenId() {
-  char c;
-  m_stream.read(&c, 1);
-  if (m_stream.eof()) {
+TokenId YackTokenReader::readTokenId(std::size_t &pos) {
+  if (pos >= m_buffer.size()) {
     return TokenId::End;
   }
 
+  auto c = m_buffer[pos++];
   switch (c) {
   case '\0':return TokenId::End;
-  case '\n':
-    if (m_lines.find(m_stream.tell() - 1) == m_lines.end()) {
-      m_lines[m_stream.tell() - 1] = m_offset == -1 ? 1 : m_lines[m_offset] + 1;
-      m_offset = m_stream.tell() - 1;
-    }
+  case '\n':m_lines.push_back(pos - 1);
     return TokenId::NewLine;
   case '\t':
   case ' ':
-    while (isspace(m_stream.peek()) && m_stream.peek() != '\n')
-      m_stream.ignore();
+    while (isspace(static_cast<unsigned char>(peek(pos))) && peek(pos) != '\n')
+      ++pos;
     return TokenId::Whitespace;
-  case '!':return readCode();
+  case '!':pos = readCode(pos);
+    return TokenId::Code;
   case ':':return TokenId::Colon;
-  case '$':return readDollar();
-  case '[':return readCondition();
+  case '$':pos = readDollar(pos);
+    return TokenId::Dollar;
+  case '[':pos = readCondition(pos);
+    return TokenId::Condition;
   case '=':return TokenId::Assign;
-  case '\"':return readString();
+  case '\"':pos = readString(pos);
+    return TokenId::String;
   case '#':
-  case ';':return readComment();
+  case ';':pos = readComment(pos);
+    return TokenId::Comment;
   default:
-    if (c == '-' && m_stream.peek() == '>') {
-      m_stream.ignore();
+    if (c == '-' && peek(pos) == '>') {
+      ++pos;
       return TokenId::Goto;
     }
-    if (c == '-' || isdigit(c)) {
-      return readNumber();
-    } else if (isalpha(c)) {
-      return readIdentifier(c);
+    if (c == '-' || isdigit(static_cast<unsigned char>(c))) {
+      pos = readNumber(pos);
+      return TokenId::Number;
     }
-    error("unknown character: {}", c);
+    if (isalpha(static_cast<unsigned char>(c))) {
+      auto start = pos - 1;
+      while (isalnum(static_cast<unsigned char>(peek(pos))) || peek(pos) == '_')
+        ++pos;
+      if (std::string_view(m_buffer.data() + start, pos - start) == "waitwhile") {
+        pos = readCode(pos);
+        return TokenId::WaitWhile;
+      }
+      return TokenId::Identifier;
+    }
+    error("unknown character: {} (line {})", c, getLine(pos - 1));
     return TokenId::None;
   }
 }
 
-TokenId YackTokenReader::readCode() {
+std::size_t YackTokenReader::readCode(std::size_t pos) const {
   char c;
   char previousChar = '\0';
-  while ((c = m_stream.peek()) != '\n' && c != '\0') {
-    m_stream.ignore();
-    if (previousChar == ' ' && c == '[' && m_stream.peek() != ' ') {
-      m_stream.seek(m_stream.tell() - 1);
-      return TokenId::Code;
+  while ((c = peek(pos)) != '\n' && c != '\0') {
+    ++pos;
+    // a condition starts after the code
+    if (previousChar == ' ' && c == '[' && peek(pos) != ' ') {
+      return pos - 1;
     }
     previousChar = c;
   }
-  return TokenId::Code;
+  return pos;
 }
 
-TokenId YackTokenReader::readDollar() {
+std::size_t YackTokenReader::readDollar(std::size_t pos) const {
   char c;
-  while ((c = m_stream.peek()) != '[' && c != ' ' && c != '\n' && c != '\0') {
-    m_stream.ignore();
+  while ((c = peek(pos)) != '[' && c != ' ' && c != '\n' && c != '\0') {
+    ++pos;
   }
-  return TokenId::Dollar;
+  return pos;
 }
 
-TokenId YackTokenReader::readCondition() {
-  while (m_stream.peek() != ']') {
-    m_stream.ignore();
-  }
-  m_stream.ignore();
-  return TokenId::Condition;
+std::size_t YackTokenReader::readCondition(std::size_t pos) const {
+  auto it = std::find(m_buffer.cbegin() + pos, m_buffer.cend(), ']');
+  return std::min(static_cast<std::size_t>(std::distance(m_buffer.cbegin(), it)) + 1, m_buffer.size());
 }
 
-TokenId YackTokenReader::readNumber() {
-  while (isdigit(m_stream.peek())) {
-    m_stream.ignore();
+std::size_t YackTokenReader::readNumber(std::size_t pos) const {
+  while (isdigit(static_cast<unsigned char>(peek(pos)))) {
+    ++pos;
   }
-  if (m_stream.peek() == '.') {
-    m_stream.ignore();
+  if (peek(pos) == '.') {
+    ++pos;
   }
-  while (isdigit(m_stream.peek())) {
-    m_stream.ignore();
+  while (isdigit(static_cast<unsigned char>(peek(pos)))) {
+    ++pos;
   }
-  return TokenId::Number;
-}
-
-TokenId YackTokenReader::readComment() {
-  m_stream.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-  m_stream.seek(m_stream.tell() - 1);
-  return TokenId::Comment;
+  return pos;
 }
 
-TokenId YackTokenReader::readString() {
-  m_stream.ignore(std::numeric_limits<std::streamsize>::max(), '\"');
-  return TokenId::String;
+std::size_t YackTokenReader::readComment(std::size_t pos) const {
+  auto it = std::find(m_buffer.cbegin() + pos, m_buffer.cend(), '\n');
+  return static_cast<std::size_t>(std::distance(m_buffer.cbegin(), it));
 }
 
-TokenId YackTokenReader::readIdentifier(char c) {
-  std::string id;
-  id.push_back(c);
-  while (isalnum(m_stream.peek()) || m_stream.peek() == '_') {
-    m_stream.read(&c, 1);
-    id.push_back(c);
-  }
-  if (id == "waitwhile") {
-    readCode();
-    return TokenId::WaitWhile;
-  }
-  return TokenId::Identifier;
+std::size_t YackTokenReader::readString(std::size_t pos) const {
+  auto it = std::find(m_buffer.cbegin() + pos, m_buffer.cend(), '\"');
+  return std::min(static_cast<std::size_t>(std::distance(m_buffer.cbegin(), it)) + 1, m_buffer.size());
 }
 } // namespace ng
@@ -0,0 +1,114 @@
+#include <algorithm>
+#include <cmath>
+#include <engge/Entities/Object.hpp>
+#include "HotspotGrid.hpp"
+
+namespace ng {
+namespace {
+int getCell(int coordinate, int cellSize) {
+  return static_cast<int>(std::floor(static_cast<float>(coordinate) / static_cast<float>(cellSize)));
+}
+}
+
+void HotspotGrid::invalidate() {
+  m_isDirty = true;
+  m_dirtyObjects.clear();
+}
+
+void HotspotGrid::invalidate(const Object &object) {
+  if (m_isDirty)
+    return;
+  if (m_dirtyObjects.size() >= MaxDirtyObjects) {
+    // too many changes since the last query: rebuild the grid
+    invalidate();
+    return;
+  }
+  m_dirtyObjects.push_back(&object);
+}
+
+void HotspotGrid::getObjectsAt(const std::vector<std::unique_ptr<Object>> &objects,
+                               glm::ivec2 pos,
+                               std::vector<Object *> &result) {
+  result.clear();
+  update(objects);
+
+  auto it = m_cells.find(getCellKey(getCell(pos.x, CellSize), getCell(pos.y, CellSize)));
+  if (it == m_cells.end())
+    return;
+
+  for (auto index : it->second) {
+    const auto &entry = m_entries[index];
+    if (entry.hotspot.contains(pos)) {
+      result.push_back(entry.pObject);
+    }
+  }
+}
+
+void HotspotGrid::update(const std::vector<std::unique_ptr<Object>> &objects) {
+  if (!m_isDirty && m_entries.size() == objects.size()) {
+    // only update the objects which have changed
+    for (auto pObject : m_dirtyObjects) {
+      auto it = m_indices.find(pObject);
+      if (it == m_indices.end())
+        continue;
+      remove(it->second);
+      m_entries[it->second].hotspot = pObject->getRealHotspot();
+      insert(it->second);
+    }
+    m_dirtyObjects.clear();
+    return;
+  }
+
+  // rebuild the whole grid
+  m_entries.clear();
+  m_indices.clear();
+  m_cells.clear();
+  m_dirtyObjects.clear();
+  m_entries.reserve(objects.size());
+  for (const auto &pObject : objects) {
+    m_indices[pObject.get()] = m_entries.size();
+    m_entries.push_back({pObject.get(), pObject->getRealHotspot()});
+    insert(m_entries.size() - 1);
+  }
+  m_isDirty = false;
+}
+
+void HotspotGrid::insert(size_t index) {
+  // keep the indices of each cell sorted, i.e. in the order of the room objects
+  forEachCell(m_entries[index].hotspot, [this, index](int64_t key) {
+    auto &indices = m_cells[key];
+    indices.insert(std::lower_bound(indices.begin(), indices.end(), index), index);
+  });
+}
+
+void HotspotGrid::remove(size_t index) {
+  forEachCell(m_entries[index].hotspot, [this, index](int64_t key) {
+    auto it = m_cells.find(key);
+    if (it == m_cells.end())
+      return;
+    auto &indices = it->second;
+    auto itIndex = std::lower_bound(indices.begin(), indices.end(), index);
+    if (itIndex != indices.end() && *itIndex == index)
+      indices.erase(itIndex);
+  });
+}
+
+template<typename TFunc>
+void HotspotGrid::forEachCell(const ngf::irect &rect, TFunc func) {
+  auto pos = rect.getPosition();
+  auto size = rect.getSize();
+  auto x1 = getCell(std::min(pos.x, pos.x + size.x), CellSize);
+  auto x2 = getCell(std::max(pos.x, pos.x + size.x), CellSize);
+  auto y1 = getCell(std::min(pos.y, pos.y + size.y), CellSize);
+  auto y2 = getCell(std::max(pos.y, pos.y + size.y), CellSize);
+  for (auto y = y1; y <= y2; ++y) {
+    for (auto x = x1; x <= x2; ++x) {
+      func(getCellKey(x, y));
+    }
+  }
+}
+
+int64_t HotspotGrid::getCellKey(int x, int y) {
+  return (static_cast<int64_t>(x) << 32) | static_cast<uint32_t>(y);
+}
+} // namespace ng
@@ -0,0 +1,51 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include <glm/vec2.hpp>
+#include <ngf/Graphics/Rect.h>
+
+namespace ng {
+class Object;
+
+/// @brief Uniform grid over the hotspots of the objects of a room, in room coordinates.
+///
+/// The real hotspot of an object is computed only when it has been invalidated,
+/// i.e. when the object is moved or when its hotspot changes.
+class HotspotGrid {
+public:
+  /// Indicates that the objects of the room have been added or removed.
+  void invalidate();
+  /// Indicates that the real hotspot of an object has changed.
+  void invalidate(const Object &object);
+
+  /// Gets the objects whose real hotspot contains the given position, in the order of the room objects.
+  void getObjectsAt(const std::vector<std::unique_ptr<Object>> &objects,
+                    glm::ivec2 pos,
+                    std::vector<Object *> &result);
+
+private:
+  struct Entry {
+    Object *pObject{nullptr};
+    ngf::irect hotspot;
+  };
+
+  static constexpr int CellSize = 128;
+  static constexpr size_t MaxDirtyObjects = 256;
+
+  void update(const std::vector<std::unique_ptr<Object>> &objects);
+  void insert(size_t index);
+  void remove(size_t index);
+  template<typename TFunc>
+  static void forEachCell(const ngf::irect &rect, TFunc func);
+  static int64_t getCellKey(int x, int y);
+
+private:
+  std::vector<Entry> m_entries;
+  std::unordered_map<const Object *, size_t> m_indices;
+  std::unordered_map<int64_t, std::vector<size_t>> m_cells;
+  std::vector<const Object *> m_dirtyObjects;
+  bool m_isDirty{true};
+};
+} // namespace ng
@@ -1,4 +1,5 @@
 #include <engge/Room/Room.hpp>
+#include <engge/Engine/AssetCache.hpp>
 #include <engge/Engine/EngineSettings.hpp>
 #include <engge/Engine/Light.hpp>
 #include <engge/System/Locator.hpp>
@@ -11,12 +12,14 @@
 #include <engge/Scripting/ScriptEngine.hpp>
 #include <engge/Entities/AnimationLoader.hpp>
 #include "Util/Util.hpp"
+#include "HotspotGrid.hpp"
+#include "WalkboxNavigation.hpp"
 #include <squirrel.h>
 #include <algorithm>
 #include <iostream>
 #include <cmath>
 #include <memory>
-#include <ngf/Math/PathFinding/PathFinder.h>
+#include <set>
 #include <ngf/Math/PathFinding/Walkbox.h>
 #include <ngf/Graphics/RectangleShape.h>
 #include <ngf/Graphics/FntFont.h>
@@ -32,7 +35,6 @@ struct Room::Impl {
   std::vector<std::unique_ptr<Object>> _objects;
   std::vector<Object *> _objectsToDelete;
   std::vector<ngf::Walkbox> _walkboxes;
-  std::vector<ngf::Walkbox> _graphWalkboxes;
   std::map<int, std::unique_ptr<RoomLayer>, CmpLayer> _layers;
   std::vector<RoomScaling> _scalings;
   RoomScaling _scaling;
@@ -42,7 +44,8 @@ struct Room::Impl {
   std::string _name;
   int _fullscreen{0};
   HSQOBJECT _roomTable{};
-  std::shared_ptr<ngf::PathFinder> _pf;
+  WalkboxNavigation _navigation;
+  HotspotGrid _hotspots;
   ngf::Color _ambientColor{255, 255, 255, 255};
   SpriteSheet _spriteSheet;
   Room *_pRoom{nullptr};
@@ -281,6 +284,7 @@ struct Room::Impl {
             sq_getstackobj(v, -1, &obj->getTable());
             sq_addref(v, &obj->getTable());
             sq_pop(v, 2);
+            obj->invalidateProperties();
           } else {
             sq_addref(v, &object);
             obj = std::make_unique<Object>(object);
@@ -372,27 +376,7 @@ struct Room::Impl {
       }
       _walkboxes.push_back(walkbox);
     }
-    _pf.reset();
-  }
-
-  bool updateGraph(const glm::vec2 &start) {
-    _graphWalkboxes.clear();
-    if (!_walkboxes.empty()) {
-      _graphWalkboxes = ngf::Walkbox::merge(_walkboxes);
-      return sortWalkboxes(start);
-    }
-    return false;
-  }
-
-  bool sortWalkboxes(const glm::vec2 &start) {
-    auto it = std::find_if(_graphWalkboxes.begin(), _graphWalkboxes.end(), [start](auto &w) {
-      return w.inside(start);
-    });
-    if (it != _graphWalkboxes.end()) {
-      std::iter_swap(_graphWalkboxes.begin(), it);
-    }
-    _pf = std::make_shared<ngf::PathFinder>(_graphWalkboxes);
-    return true;
+    _navigation.clear();
   }
 };
 
@@ -430,11 +414,14 @@ std::unique_ptr<Room> Room::define(HSQOBJECT roomTable, const char *name) {
 Room::Room(HSQOBJECT roomTable)
     : m_pImpl(std::make_unique<Impl>(roomTable)) {
   m_id = Locator<EntityManager>::get().getRoomId();
+  Locator<EntityManager>::get().addScriptObject(this);
   m_pImpl->setRoom(this);
   ScriptEngine::set(this, "_id", getId());
 }
 
-Room::~Room() = default;
+Room::~Room() {
+  Locator<EntityManager>::get().removeScriptObject(this);
+}
 
 void Room::setName(const std::string &name) { m_pImpl->_name = name; }
 std::string Room::getName() const { return m_pImpl->_name; }
@@ -456,7 +443,7 @@ const ngf::Walkbox *Room::getWalkbox(const std::string &name) const {
   return nullptr;
 }
 
-std::vector<ngf::Walkbox> &Room::getGraphWalkboxes() { return m_pImpl->_graphWalkboxes; }
+std::vector<ngf::Walkbox> &Room::getGraphWalkboxes() { return m_pImpl->_navigation.getGraphWalkboxes(); }
 
 glm::ivec2 Room::getRoomSize() const { return m_pImpl->_roomSize; }
 
@@ -486,6 +473,7 @@ void Room::removeEntity(Entity *pEntity) {
   m_pImpl->_objects.erase(std::remove_if(m_pImpl->_objects.begin(), m_pImpl->_objects.end(),
                                          [pEntity](auto &pObj) { return pObj.get() == pEntity; }),
                           m_pImpl->_objects.end());
+  m_pImpl->_hotspots.invalidate();
 }
 
 void Room::load(const char *name) {
@@ -497,7 +485,7 @@ void Room::load(const char *name) {
   if (!Locator<EngineSettings>::get().hasEntry(wimpyFilename))
     return;
 
-  auto hash = Locator<EngineSettings>::get().readEntry(wimpyFilename);
+  auto hash = Locator<AssetCache>::get().readHashEntry(wimpyFilename);
 
 #if 0
   std::ofstream out;
@@ -520,6 +508,32 @@ void Room::load(const char *name) {
   m_pImpl->loadWalkboxes(hash);
 }
 
+static void addAnimationTextures(const Animation &anim, std::set<std::string> &textures) {
+  if (!anim.texture.empty()) {
+    textures.insert(anim.texture);
+  }
+  for (const auto &layer : anim.layers) {
+    addAnimationTextures(layer, textures);
+  }
+}
+
+void Room::prefetch() {
+  std::set<std::string> textures;
+  if (!m_pImpl->_sheet.empty()) {
+    textures.insert(m_pImpl->_spriteSheet.getTextureName());
+  }
+  for (auto &obj : m_pImpl->_objects) {
+    for (const auto &anim : obj->getAnims()) {
+      addAnimationTextures(anim, textures);
+    }
+  }
+
+  trace("Prefetch room {} ({} textures)", getName(), textures.size());
+  for (const auto &texture : textures) {
+    m_pImpl->_textureManager.loadTextureAsync(texture);
+  }
+}
+
 TextObject &Room::createTextObject(const std::string &fontName) {
   auto object = std::make_unique<TextObject>();
   std::string path;
@@ -608,10 +622,7 @@ Object &Room::createObject() {
 }
 
 const ngf::Graph *Room::getGraph() const {
-  if (m_pImpl->_pf) {
-    return m_pImpl->_pf->getGraph().get();
-  }
-  return nullptr;
+  return m_pImpl->_navigation.getGraph();
 }
 
 void Room::update(const ngf::TimeSpan &elapsed) {
@@ -625,6 +636,7 @@ void Room::update(const ngf::TimeSpan &elapsed) {
           [&obj](auto &pObj) { return pObj.get() == obj; }), m_pImpl->_objects.end());
     }
     m_pImpl->_objectsToDelete.clear();
+    m_pImpl->_hotspots.invalidate();
   }
 
   for (auto &&layer : m_pImpl->_layers) {
@@ -679,22 +691,24 @@ void Room::setWalkboxEnabled(const std::string &name, bool isEnabled) {
     return;
   }
   it->setEnabled(isEnabled);
-  m_pImpl->_pf.reset();
 }
 
 std::vector<RoomScaling> &Room::getScalings() { return m_pImpl->_scalings; }
 
+void Room::getObjectsAt(glm::ivec2 pos, std::vector<Object *> &objects) const {
+  m_pImpl->_hotspots.getObjectsAt(m_pImpl->_objects, pos, objects);
+}
+
+void Room::invalidateHotspot(const Object &object) {
+  m_pImpl->_hotspots.invalidate(object);
+}
+
 std::vector<glm::vec2> Room::calculatePath(glm::vec2 start, glm::vec2 end) const {
-  if (!m_pImpl->_pf) {
-    if (!m_pImpl->updateGraph(start)) {
-      return std::vector<glm::vec2>();
-    }
-  } else if (!m_pImpl->_graphWalkboxes.empty() && !m_pImpl->_graphWalkboxes[0].inside(start)) {
-    if (!m_pImpl->sortWalkboxes(start)) {
-      return std::vector<glm::vec2>();
-    }
-  }
-  return m_pImpl->_pf->calculatePath(start, end);
+  return m_pImpl->_navigation.calculatePath(m_pImpl->_walkboxes, start, end);
+}
+
+std::shared_future<std::vector<glm::vec2>> Room::calculatePathAsync(glm::vec2 start, glm::vec2 end) const {
+  return m_pImpl->_navigation.calculatePathAsync(m_pImpl->_walkboxes, start, end);
 }
 
 float Room::getRotation() const { return m_pImpl->_rotation; }
@@ -723,6 +737,7 @@ void Room::exit() {
   }
   m_pImpl->_objects.erase(std::remove_if(m_pImpl->_objects.begin(), m_pImpl->_objects.end(),
                                          [](auto &pObj) { return pObj->isTemporary(); }), m_pImpl->_objects.end());
+  m_pImpl->_hotspots.invalidate();
 }
 
 void Room::setEffect(int effect) { m_pImpl->setEffect(effect); }
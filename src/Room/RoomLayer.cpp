@@ -1,5 +1,5 @@
-#include <ngf/Graphics/Sprite.h>
 #include <engge/Graphics/LightingShader.h>
+#include <ngf/Math/Transform.h>
 #include "engge/Room/RoomLayer.hpp"
 #include "engge/Graphics/ResourceManager.hpp"
 #include "engge/System/Locator.hpp"
@@ -11,12 +11,48 @@ void RoomLayer::setTexture(const std::string &textureName) {
   m_textureName = textureName;
 }
 
-void RoomLayer::addEntity(Entity &entity) { m_entities.emplace_back(entity); }
+void RoomLayer::addEntity(Entity &entity) {
+  m_entities.emplace_back(entity);
+  m_renderList.push_back(RenderItem{&entity, entity.getZOrder()});
+  m_isRenderListDirty = true;
+}
 
 void RoomLayer::removeEntity(Entity &entity) {
   m_entities.erase(std::remove_if(m_entities.begin(), m_entities.end(),
                                   [&entity](auto &pEntity) -> bool { return &pEntity.get() == &entity; }),
                    m_entities.end());
+  // removing an entity keeps the list sorted
+  m_renderList.erase(std::remove_if(m_renderList.begin(), m_renderList.end(),
+                                    [&entity](const auto &item) { return item.pEntity == &entity; }),
+                     m_renderList.end());
+}
+
+void RoomLayer::updateRenderList() const {
+  for (auto &item : m_renderList) {
+    auto zorder = item.pEntity->getZOrder();
+    if (item.zorder != zorder) {
+      item.zorder = zorder;
+      m_isRenderListDirty = true;
+    }
+  }
+  if (!m_isRenderListDirty)
+    return;
+
+  // few entities move between 2 frames: an insertion sort is close to linear
+  auto isBefore = [](const RenderItem &a, const RenderItem &b) {
+    if (a.zorder == b.zorder)
+      return a.pEntity->getId() < b.pEntity->getId();
+    return a.zorder > b.zorder;
+  };
+  for (size_t i = 1; i < m_renderList.size(); ++i) {
+    auto item = m_renderList[i];
+    auto j = i;
+    for (; j > 0 && isBefore(item, m_renderList[j - 1]); --j) {
+      m_renderList[j] = m_renderList[j - 1];
+    }
+    m_renderList[j] = item;
+  }
+  m_isRenderListDirty = false;
 }
 
 void RoomLayer::draw(ngf::RenderTarget &target, ngf::RenderStates states) const {
@@ -31,37 +67,28 @@ void RoomLayer::draw(ngf::RenderTarget &target, ngf::RenderStates states) const
   pShader->setNumberLights(0);
 
   // sort entities by z-order
-  std::vector<std::reference_wrapper<Entity>> entities;
-  std::copy(m_entities.begin(), m_entities.end(), std::back_inserter(entities));
-  std::sort(entities.begin(), entities.end(),
-            [](const Entity &a, const Entity &b) {
-              if (a.getZOrder() == b.getZOrder())
-                return a.getId() < b.getId();
-              return a.getZOrder() > b.getZOrder();
-            });
+  updateRenderList();
 
   float offsetX = 0.f;
-  // draw layer sprites
-  for (const auto &item : m_backgrounds) {
+  // draw layer sprites: they are not lit, so they can be drawn in a single batch
+  if (!m_backgrounds.empty()) {
     auto texture = Locator<ResourceManager>::get().getTexture(m_textureName);
-    auto texSize = texture->getSize();
-    pShader->setTexture(*texture);
-    pShader->setContentSize(item.sourceSize);
-    pShader->setSpriteOffset({0, -item.frame.getHeight()});
-    pShader->setSpritePosInSheet({static_cast<float>(item.frame.min.x) / texSize.x,
-                                  static_cast<float>(item.frame.min.y) / texSize.y});
-    pShader->setSpriteSizeRelToSheet({static_cast<float>(item.sourceSize.x) / texSize.x,
-                                      static_cast<float>(item.sourceSize.y) / texSize.y});
-
-    ngf::Sprite s(*texture, item.frame);
-    glm::vec2 off{item.spriteSourceSize.min.x, item.spriteSourceSize.min.y + m_roomSizeY - item.sourceSize.y};
-    s.getTransform().setPosition(off + glm::vec2{offsetX, m_offsetY});
-    offsetX += item.frame.getWidth();
-    s.draw(target, states);
+    for (const auto &item : m_backgrounds) {
+      ngf::Transform t;
+      glm::vec2 off{item.spriteSourceSize.min.x, item.spriteSourceSize.min.y + m_roomSizeY - item.sourceSize.y};
+      t.setPosition(off + glm::vec2{offsetX, m_offsetY});
+      offsetX += item.frame.getWidth();
+
+      auto spriteStates = states;
+      spriteStates.transform = t.getTransform() * states.transform;
+      m_batch.draw(target, *texture, item.frame, ngf::Colors::White, spriteStates);
+    }
+    m_batch.flush(target);
   }
 
   // draw layer entities: actors and objects
-  for (const Entity &entity : entities) {
+  for (const auto &item : m_renderList) {
+    const Entity &entity = *item.pEntity;
     if (entity.hasParent())
       continue;
 
@@ -0,0 +1,129 @@
+#include <algorithm>
+#include <engge/Graphics/AssetLoader.hpp>
+#include <ngf/Math/PathFinding/PathFinder.h>
+#include "WalkboxNavigation.hpp"
+
+namespace ng {
+namespace {
+// path jobs get their own pool so that they are not queued behind the asset loading
+AssetLoader &getPathWorkers() {
+  static AssetLoader workers;
+  return workers;
+}
+}
+
+WalkboxNavigation::Topology::Topology(std::vector<ngf::Walkbox> walkboxes)
+    : walkboxes(std::move(walkboxes)), areas(this->walkboxes.size()) {
+}
+
+WalkboxNavigation::Area &WalkboxNavigation::Topology::getArea(glm::vec2 start) {
+  auto it = std::find_if(walkboxes.cbegin(), walkboxes.cend(), [start](const auto &walkbox) {
+    return walkbox.inside(start);
+  });
+  auto index = it == walkboxes.cend() ? 0 : std::distance(walkboxes.cbegin(), it);
+  return areas[index];
+}
+
+WalkboxNavigation::Path WalkboxNavigation::Topology::calculatePath(glm::vec2 start, glm::vec2 end) {
+  PathKey key{start.x, start.y, end.x, end.y};
+  {
+    std::scoped_lock lock(pathsMutex);
+    auto it = paths.find(key);
+    if (it != paths.end())
+      return it->second;
+  }
+
+  Path path;
+  {
+    auto &area = getArea(start);
+    std::scoped_lock lock(area.mutex);
+    if (!area.finder) {
+      // the path finder expects the walkbox containing the start position to be the first one
+      auto index = std::distance(areas.data(), &area);
+      auto sortedWalkboxes = walkboxes;
+      std::iter_swap(sortedWalkboxes.begin(), sortedWalkboxes.begin() + index);
+      area.finder = std::make_shared<ngf::PathFinder>(sortedWalkboxes);
+    }
+    path = area.finder->calculatePath(start, end);
+  }
+
+  std::scoped_lock lock(pathsMutex);
+  if (paths.size() >= MaxPaths) {
+    paths.clear();
+  }
+  paths.emplace(key, path);
+  return path;
+}
+
+void WalkboxNavigation::clear() {
+  m_topologies.clear();
+  m_pTopology = nullptr;
+  m_pArea = nullptr;
+}
+
+WalkboxNavigation::Path WalkboxNavigation::calculatePath(const std::vector<ngf::Walkbox> &walkboxes,
+                                                         glm::vec2 start,
+                                                         glm::vec2 end) {
+  auto pTopology = getTopology(walkboxes);
+  if (!pTopology)
+    return Path();
+  m_pArea = &pTopology->getArea(start);
+  return pTopology->calculatePath(start, end);
+}
+
+std::shared_future<WalkboxNavigation::Path> WalkboxNavigation::calculatePathAsync(const std::vector<ngf::Walkbox> &walkboxes,
+                                                                                  glm::vec2 start,
+                                                                                  glm::vec2 end) {
+  auto pTopology = getTopology(walkboxes);
+  if (!pTopology) {
+    std::promise<Path> promise;
+    promise.set_value(Path());
+    return promise.get_future().share();
+  }
+  m_pArea = &pTopology->getArea(start);
+
+  // the job keeps the topology alive even if the room changes its walkboxes in the meantime
+  auto pTask = std::make_shared<std::packaged_task<Path()>>([pTopology, start, end] {
+    return pTopology->calculatePath(start, end);
+  });
+  auto future = pTask->get_future().share();
+  getPathWorkers().enqueue([pTask] { (*pTask)(); });
+  return future;
+}
+
+std::vector<ngf::Walkbox> &WalkboxNavigation::getGraphWalkboxes() {
+  return m_pTopology ? m_pTopology->walkboxes : m_emptyWalkboxes;
+}
+
+const ngf::Graph *WalkboxNavigation::getGraph() const {
+  if (!m_pArea)
+    return nullptr;
+  std::scoped_lock lock(m_pArea->mutex);
+  return m_pArea->finder ? m_pArea->finder->getGraph().get() : nullptr;
+}
+
+std::shared_ptr<WalkboxNavigation::Topology> WalkboxNavigation::getTopology(const std::vector<ngf::Walkbox> &walkboxes) {
+  if (walkboxes.empty())
+    return nullptr;
+
+  std::vector<bool> key(walkboxes.size());
+  std::transform(walkboxes.cbegin(), walkboxes.cend(), key.begin(), [](const auto &walkbox) {
+    return walkbox.isEnabled();
+  });
+
+  auto it = m_topologies.find(key);
+  if (it == m_topologies.end()) {
+    if (m_topologies.size() >= MaxTopologies) {
+      clear();
+    }
+    // merge the walkboxes only once per topology
+    auto pTopology = std::make_shared<Topology>(ngf::Walkbox::merge(walkboxes));
+    it = m_topologies.emplace(std::move(key), std::move(pTopology)).first;
+  }
+  if (m_pTopology != it->second) {
+    m_pTopology = it->second;
+    m_pArea = nullptr;
+  }
+  return m_pTopology->walkboxes.empty() ? nullptr : m_pTopology;
+}
+} // namespace ng
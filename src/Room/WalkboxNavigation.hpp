@@ -0,0 +1,76 @@
+#pragma once
+#include <array>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <glm/vec2.hpp>
+#include <ngf/Math/PathFinding/Walkbox.h>
+
+namespace ngf {
+class Graph;
+class PathFinder;
+}
+
+namespace ng {
+/// @brief Keeps the navigation data of a room between walks.
+///
+/// The walkboxes are merged once per combination of enabled walkboxes (topology),
+/// each merged area gets its own path finder, created the first time a walk starts inside it,
+/// and the computed paths are cached. When a walkbox is toggled back to a previous state,
+/// the navigation data of this state is reused.
+///
+/// A topology is never modified once created, so paths can be calculated
+/// in background against it while the room toggles its walkboxes.
+class WalkboxNavigation {
+public:
+  using Path = std::vector<glm::vec2>;
+
+  /// Discards all the navigation data, this has to be called when the walkboxes are replaced.
+  void clear();
+
+  /// Calculates a path from start to end with the given walkboxes.
+  Path calculatePath(const std::vector<ngf::Walkbox> &walkboxes, glm::vec2 start, glm::vec2 end);
+  /// Queues the calculation of a path from start to end with the given walkboxes.
+  /// The paths queued in the same frame are calculated in parallel by a pool of workers.
+  std::shared_future<Path> calculatePathAsync(const std::vector<ngf::Walkbox> &walkboxes,
+                                              glm::vec2 start,
+                                              glm::vec2 end);
+
+  /// Gets the merged walkboxes of the current topology.
+  std::vector<ngf::Walkbox> &getGraphWalkboxes();
+  /// Gets the graph used by the last path calculation or nullptr if none.
+  [[nodiscard]] const ngf::Graph *getGraph() const;
+
+private:
+  using PathKey = std::array<float, 4>;
+
+  struct Area {
+    std::mutex mutex;
+    std::shared_ptr<ngf::PathFinder> finder;
+  };
+
+  struct Topology {
+    explicit Topology(std::vector<ngf::Walkbox> walkboxes);
+
+    Area &getArea(glm::vec2 start);
+    Path calculatePath(glm::vec2 start, glm::vec2 end);
+
+    std::vector<ngf::Walkbox> walkboxes;
+    std::vector<Area> areas;
+    std::map<PathKey, Path> paths;
+    std::mutex pathsMutex;
+  };
+
+  std::shared_ptr<Topology> getTopology(const std::vector<ngf::Walkbox> &walkboxes);
+
+private:
+  static constexpr size_t MaxTopologies = 8;
+  static constexpr size_t MaxPaths = 64;
+  std::map<std::vector<bool>, std::shared_ptr<Topology>> m_topologies;
+  std::shared_ptr<Topology> m_pTopology;
+  Area *m_pArea{nullptr};
+  std::vector<ngf::Walkbox> m_emptyWalkboxes;
+};
+} // namespace ng
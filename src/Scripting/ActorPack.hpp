@@ -820,7 +820,7 @@ private:
         auto usePos = pObject->getUsePosition().value_or(glm::vec2());
         pos.x += usePos.x;
         pos.y += usePos.y;
-        pActor->walkTo(pos, toFacing(pObject->getUseDirection()));
+        pActor->walkToAsync(pos, toFacing(pObject->getUseDirection()));
         return 0;
       }
 
@@ -830,7 +830,7 @@ private:
       }
 
       auto pos = pActor->getPosition();
-      pActor->walkTo(glm::vec2(pos), getOppositeFacing(pActor->getCostume().getFacing()));
+      pActor->walkToAsync(glm::vec2(pos), getOppositeFacing(pActor->getCostume().getFacing()));
       return 0;
     }
 
@@ -841,7 +841,7 @@ private:
     if (SQ_FAILED(sq_getinteger(v, 4, &y))) {
       return sq_throwerror(v, _SC("failed to get y"));
     }
-    pActor->walkTo(glm::vec2(x, y));
+    pActor->walkToAsync(glm::vec2(x, y));
     return 0;
   }
 
@@ -861,6 +861,7 @@ private:
     sq_resetobject(&table);
     sq_getstackobj(v, 2, &table);
     sq_addref(v, &table);
+    pActor->invalidateProperties();
 
     const char *key = nullptr;
     if (ScriptEngine::rawGet(pActor.get(), "_key", key)) {
@@ -0,0 +1,57 @@
+#include "ClosureCache.hpp"
+
+namespace ng {
+ClosureCache::ClosureCache(HSQUIRRELVM vm, bool isExpression, std::size_t capacity)
+    : m_vm(vm), m_isExpression(isExpression), m_capacity(capacity) {
+}
+
+ClosureCache::~ClosureCache() {
+  clear();
+}
+
+bool ClosureCache::push(const std::string &code) {
+  auto it = m_closures.find(code);
+  if (it != m_closures.end()) {
+    ++m_hits;
+    m_lru.splice(m_lru.begin(), m_lru, it->second);
+    sq_pushobject(m_vm, it->second->second);
+    return true;
+  }
+
+  ++m_misses;
+  SQRESULT result;
+  if (m_isExpression) {
+    std::string c;
+    c.append("return ");
+    c.append(code);
+    result = sq_compilebuffer(m_vm, c.data(), c.size(), _SC("_DefaultScriptExecute"), SQTrue);
+  } else {
+    result = sq_compilebuffer(m_vm, code.data(), code.size(), _SC("_DefaultScriptExecute"), SQTrue);
+  }
+  if (SQ_FAILED(result))
+    return false;
+
+  if (m_lru.size() >= m_capacity && !m_lru.empty()) {
+    auto &last = m_lru.back();
+    sq_release(m_vm, &last.second);
+    m_closures.erase(last.first);
+    m_lru.pop_back();
+  }
+
+  HSQOBJECT closure;
+  sq_resetobject(&closure);
+  sq_getstackobj(m_vm, -1, &closure);
+  sq_addref(m_vm, &closure);
+  m_lru.emplace_front(code, closure);
+  m_closures[code] = m_lru.begin();
+  return true;
+}
+
+void ClosureCache::clear() {
+  for (auto &entry : m_lru) {
+    sq_release(m_vm, &entry.second);
+  }
+  m_lru.clear();
+  m_closures.clear();
+}
+}
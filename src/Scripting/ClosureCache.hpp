@@ -0,0 +1,44 @@
+#pragma once
+#include <cstddef>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <squirrel.h>
+
+namespace ng {
+/// Keeps the closures compiled from script snippets so that running the same
+/// code again does not invoke the Squirrel compiler.
+/// The least recently used closure is released when the cache is full.
+class ClosureCache final {
+public:
+  /// \param vm: VM used to compile and to hold the closures.
+  /// \param isExpression: true if the snippets are expressions compiled as `return <code>`.
+  /// \param capacity: maximum number of closures kept alive.
+  ClosureCache(HSQUIRRELVM vm, bool isExpression, std::size_t capacity = 256);
+  ~ClosureCache();
+
+  ClosureCache(const ClosureCache &) = delete;
+  ClosureCache &operator=(const ClosureCache &) = delete;
+
+  /// Pushes the closure compiled from the specified code on the VM stack.
+  /// \return false if the code does not compile, nothing is pushed in this case.
+  bool push(const std::string &code);
+  void clear();
+
+  [[nodiscard]] std::size_t getSize() const { return m_closures.size(); }
+  [[nodiscard]] std::size_t getCapacity() const { return m_capacity; }
+  [[nodiscard]] std::size_t getHits() const { return m_hits; }
+  [[nodiscard]] std::size_t getMisses() const { return m_misses; }
+
+private:
+  using Entry = std::pair<std::string, HSQOBJECT>;
+
+  HSQUIRRELVM m_vm{};
+  bool m_isExpression{false};
+  std::size_t m_capacity{0};
+  std::size_t m_hits{0};
+  std::size_t m_misses{0};
+  std::list<Entry> m_lru;
+  std::unordered_map<std::string, std::list<Entry>::iterator> m_closures;
+};
+}
@@ -1,53 +1,216 @@
+#include <algorithm>
+#include <cctype>
+#include <memory>
+#include <vector>
 #include <engge/System/Logger.hpp>
+#include <engge/Engine/Engine.hpp>
 #include <engge/Engine/EntityManager.hpp>
+#include <engge/Entities/Actor.hpp>
+#include <engge/Scripting/ScriptEngine.hpp>
 #include "DefaultScriptExecute.hpp"
 
 namespace ng {
-void DefaultScriptExecute::execute(const std::string &code) {
+namespace {
+std::string trim(const std::string &code) {
+  auto first = code.find_first_not_of(" \t");
+  if (first == std::string::npos)
+    return {};
+  auto last = code.find_last_not_of(" \t");
+  return code.substr(first, last - first + 1);
+}
+
+bool isIdentifier(const std::string &code) {
+  if (code.empty() || !(isalpha(static_cast<unsigned char>(code[0])) || code[0] == '_'))
+    return false;
+  return std::all_of(code.cbegin(), code.cend(), [](char c) {
+    return isalnum(static_cast<unsigned char>(c)) || c == '_';
+  });
+}
+
+/// Splits a path like `g.flag` into its identifiers, returns false if the code is not such a path.
+bool parsePath(const std::string &code, std::vector<std::string> &path) {
+  std::string::size_type start = 0;
+  while (true) {
+    auto end = code.find('.', start);
+    auto name = code.substr(start, end == std::string::npos ? std::string::npos : end - start);
+    if (!isIdentifier(name))
+      return false;
+    path.push_back(name);
+    if (end == std::string::npos)
+      return true;
+    start = end + 1;
+  }
+}
+
+/// Parses `actorTalking()` or `actorTalking(actor)`, returns false if the code is not such a call.
+bool parseActorTalking(const std::string &code, std::string &actor) {
+  static const std::string prefix = "actorTalking(";
+  if (code.size() <= prefix.size() || code.compare(0, prefix.size(), prefix) != 0 || code.back() != ')')
+    return false;
+  actor = trim(code.substr(prefix.size(), code.size() - prefix.size() - 1));
+  return actor.empty() || isIdentifier(actor);
+}
+
+bool getPath(HSQUIRRELVM v, const std::vector<std::string> &path, HSQOBJECT &result) {
+  auto top = sq_gettop(v);
+  sq_pushroottable(v);
+  for (const auto &name : path) {
+    sq_pushstring(v, name.data(), static_cast<SQInteger>(name.size()));
+    if (SQ_FAILED(sq_get(v, -2))) {
+      sq_settop(v, top);
+      return false;
+    }
+  }
+  sq_getstackobj(v, -1, &result);
+  sq_settop(v, top);
+  return true;
+}
+
+/// Gets whether an actor is talking, returns false if the actor does not exist.
+bool isActorTalking(HSQUIRRELVM v, const std::string &actor, bool &isTalking) {
+  if (actor.empty()) {
+    auto pActor = ScriptEngine::getEngine().getCurrentActor();
+    isTalking = pActor && pActor->isTalking();
+    return true;
+  }
+  auto top = sq_gettop(v);
+  sq_pushroottable(v);
+  sq_pushstring(v, actor.data(), static_cast<SQInteger>(actor.size()));
+  Actor *pActor = nullptr;
+  if (SQ_SUCCEEDED(sq_get(v, -2))) {
+    pActor = EntityManager::getActor(v, -1);
+  }
+  sq_settop(v, top);
+  if (!pActor)
+    return false;
+  isTalking = pActor->isTalking();
+  return true;
+}
+
+/// Gets whether an object is false for squirrel, i.e. null, false or 0.
+bool isFalsy(const HSQOBJECT &object) {
+  switch (object._type) {
+  case OT_NULL:return true;
+  case OT_BOOL:return !sq_objtobool(&object);
+  case OT_INTEGER:return sq_objtointeger(&object) == 0;
+  case OT_FLOAT:return sq_objtofloat(&object) == 0;
+  default:return false;
+  }
+}
+}
+
+void DefaultScriptExecute::call(ClosureCache &cache, const std::string &code) {
   sq_resetobject(&m_result);
   auto top = sq_gettop(m_vm);
-// compile
-  sq_pushroottable(m_vm);
-  if (SQ_FAILED(sq_compilebuffer(m_vm, code.data(), code.size(), _SC("_DefaultScriptExecute"), SQTrue))) {
+// compile or get the closure already compiled
+  if (!cache.push(code)) {
     error("Error executing code {}", code);
+    sq_settop(m_vm, top);
     return;
   }
-  sq_push(m_vm, -2);
+  sq_pushroottable(m_vm);
 // call
   if (SQ_FAILED(sq_call(m_vm, 1, SQTrue, SQTrue))) {
     error("Error calling code {}", code);
+    sq_settop(m_vm, top);
     return;
   }
   sq_getstackobj(m_vm, -1, &m_result);
   sq_settop(m_vm, top);
 }
 
-bool DefaultScriptExecute::executeCondition(const std::string &code) {
-  std::string c;
-  c.append("return ");
-  c.append(code);
-
-  execute(c);
-  if (m_result._type == OT_BOOL) {
-    trace("{} returns {}", code, sq_objtobool(&m_result));
-    return sq_objtobool(&m_result);
+void DefaultScriptExecute::execute(const std::string &code) {
+  call(m_statements, code);
+}
+
+bool DefaultScriptExecute::toCondition(const HSQOBJECT &result, const std::string &code) {
+  if (result._type == OT_BOOL) {
+    trace("{} returns {}", code, sq_objtobool(&result));
+    return sq_objtobool(&result);
   }
 
-  if (m_result._type == OT_INTEGER) {
-    trace("{} return {}", code, sq_objtointeger(&m_result));
-    return sq_objtointeger(&m_result) != 0;
+  if (result._type == OT_INTEGER) {
+    trace("{} return {}", code, sq_objtointeger(&result));
+    return sq_objtointeger(&result) != 0;
   }
 
   error("Error getting result {}", code);
   return false;
 }
 
-std::string DefaultScriptExecute::executeDollar(const std::string &code) {
-  std::string c;
-  c.append("return ");
-  c.append(code);
+bool DefaultScriptExecute::executeCondition(const std::string &code) {
+  call(m_expressions, code);
+  return toCondition(m_result, code);
+}
 
-  execute(c);
+std::function<bool()> DefaultScriptExecute::compileCondition(const std::string &code) {
+  auto v = m_vm;
+
+  // native fast path for the trivial conditions: [!]g.flag or [!]actorTalking(actor)
+  auto condition = trim(code);
+  auto negate = !condition.empty() && condition[0] == '!';
+  if (negate) {
+    condition = trim(condition.substr(1));
+  }
+  // as with the compiled code, a condition that fails to evaluate is false
+  std::string actor;
+  if (parseActorTalking(condition, actor)) {
+    return [v, actor, negate]() {
+      bool isTalking;
+      if (!isActorTalking(v, actor, isTalking))
+        return false;
+      return isTalking != negate;
+    };
+  }
+  std::vector<std::string> path;
+  if (parsePath(condition, path) && path.size() > 1) {
+    return [v, path, negate]() {
+      HSQOBJECT result;
+      sq_resetobject(&result);
+      if (!getPath(v, path, result))
+        return false;
+      if (negate)
+        return isFalsy(result);
+      return (result._type == OT_BOOL && sq_objtobool(&result))
+          || (result._type == OT_INTEGER && sq_objtointeger(&result) != 0);
+    };
+  }
+
+  // otherwise compile the condition once and keep its closure alive as long as the predicate
+  auto top = sq_gettop(v);
+  if (!m_expressions.push(code)) {
+    error("Error compiling condition {}", code);
+    return []() { return false; };
+  }
+  auto pClosure = std::shared_ptr<HSQOBJECT>(new HSQOBJECT, [v](HSQOBJECT *pObject) {
+    sq_release(v, pObject);
+    delete pObject;
+  });
+  sq_resetobject(pClosure.get());
+  sq_getstackobj(v, -1, pClosure.get());
+  sq_addref(v, pClosure.get());
+  sq_settop(v, top);
+
+  return [v, pClosure, code]() {
+    auto top = sq_gettop(v);
+    sq_pushobject(v, *pClosure);
+    sq_pushroottable(v);
+    if (SQ_FAILED(sq_call(v, 1, SQTrue, SQTrue))) {
+      error("Error calling code {}", code);
+      sq_settop(v, top);
+      return false;
+    }
+    HSQOBJECT result;
+    sq_resetobject(&result);
+    sq_getstackobj(v, -1, &result);
+    auto value = toCondition(result, code);
+    sq_settop(v, top);
+    return value;
+  };
+}
+
+std::string DefaultScriptExecute::executeDollar(const std::string &code) {
+  call(m_expressions, code);
 // get the result
   if (m_result._type != OT_STRING) {
     error("Error getting result {}", code);
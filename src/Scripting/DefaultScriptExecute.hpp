@@ -1,20 +1,32 @@
 #pragma once
 #include <squirrel.h>
 #include "engge/Scripting/ScriptExecute.hpp"
+#include "ClosureCache.hpp"
 
 namespace ng {
 class DefaultScriptExecute final : public ScriptExecute {
 public:
-  explicit DefaultScriptExecute(HSQUIRRELVM vm) : m_vm(vm) {}
+  explicit DefaultScriptExecute(HSQUIRRELVM vm)
+      : m_vm(vm), m_statements(vm, false), m_expressions(vm, true) {}
 
 public:
   void execute(const std::string &code) override;
   bool executeCondition(const std::string &code) override;
+  std::function<bool()> compileCondition(const std::string &code) override;
   std::string executeDollar(const std::string &code) override;
   SoundDefinition *getSoundDefinition(const std::string &name) override;
 
+  [[nodiscard]] const ClosureCache &getStatementCache() const { return m_statements; }
+  [[nodiscard]] const ClosureCache &getExpressionCache() const { return m_expressions; }
+
+private:
+  void call(ClosureCache &cache, const std::string &code);
+  static bool toCondition(const HSQOBJECT &result, const std::string &code);
+
 private:
   HSQUIRRELVM m_vm{};
   HSQOBJECT m_result{};
+  ClosureCache m_statements;
+  ClosureCache m_expressions;
 };
 }
@@ -93,6 +93,7 @@ private:
     ScriptEngine::registerGlobalFunction(lightTurnOn, "lightTurnOn");
     ScriptEngine::registerGlobalFunction(lightZRange, "lightZRange");
     ScriptEngine::registerGlobalFunction(masterRoomArray, "masterRoomArray");
+    ScriptEngine::registerGlobalFunction(prefetchRoom, "prefetchRoom");
     ScriptEngine::registerGlobalFunction(removeTrigger, "removeTrigger");
     ScriptEngine::registerGlobalFunction(roomActors, "roomActors");
     ScriptEngine::registerGlobalFunction(roomEffect, "roomEffect");
@@ -430,6 +431,26 @@ private:
     return 1;
   }
 
+  static SQInteger prefetchRoom(HSQUIRRELVM v) {
+    Room *pRoom = nullptr;
+    if (sq_gettype(v, 2) == OT_STRING) {
+      const SQChar *name = nullptr;
+      sq_getstring(v, 2, &name);
+      auto &rooms = g_pEngine->getRooms();
+      auto it = std::find_if(rooms.begin(), rooms.end(), [name](auto &room) { return room->getName() == name; });
+      if (it != rooms.end()) {
+        pRoom = it->get();
+      }
+    } else {
+      pRoom = EntityManager::getRoom(v, 2);
+    }
+    if (!pRoom) {
+      return sq_throwerror(v, _SC("failed to get room"));
+    }
+    g_pEngine->prefetchRoom(pRoom);
+    return 0;
+  }
+
   static SQInteger walkboxHidden(HSQUIRRELVM v) {
     const SQChar *name = nullptr;
     if (SQ_FAILED(sq_getstring(v, 2, &name))) {
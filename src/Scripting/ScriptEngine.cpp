@@ -1,4 +1,5 @@
 #include <cstdarg>
+#include <cstring>
 #include <squirrel.h>
 #include "../../extlibs/squirrel/squirrel/sqpcheader.h"
 #include "../../extlibs/squirrel/squirrel/sqvm.h"
@@ -7,6 +8,8 @@
 #include <sqstdaux.h>
 #include <sqstdstring.h>
 #include <sqstdmath.h>
+#include "engge/Engine/AssetCache.hpp"
+#include "engge/Engine/EngineSettings.hpp"
 #include "engge/Entities/Entity.hpp"
 #include "engge/System/Locator.hpp"
 #include "engge/System/Logger.hpp"
@@ -343,27 +346,58 @@ void ScriptEngine::executeScript(const std::string &name) {
   }
 }
 
-void ScriptEngine::executeNutScript(const std::string &name) {
+namespace {
+struct BytecodeReader {
+  const std::vector<char> &data;
+  size_t offset{0};
+};
+
+SQInteger writeBytecode(SQUserPointer up, SQUserPointer data, SQInteger size) {
+  auto &bytecode = *static_cast<std::vector<char> *>(up);
+  auto pData = static_cast<const char *>(data);
+  bytecode.insert(bytecode.end(), pData, pData + size);
+  return size;
+}
+
+SQInteger readBytecode(SQUserPointer up, SQUserPointer data, SQInteger size) {
+  auto &reader = *static_cast<BytecodeReader *>(up);
+  if (reader.offset + size > reader.data.size())
+    return -1;
+  memcpy(data, reader.data.data() + reader.offset, size);
+  reader.offset += size;
+  return size;
+}
+}
+
+bool ScriptEngine::compileNutScript(const std::string &name) {
   std::vector<char> code;
 
-  std::ifstream is(name);
-  if (is.is_open()) {
+  auto &settings = Locator<EngineSettings>::get();
+  if (settings.hasEntry(name)) {
     trace("Load local file file {}", name);
-    is.seekg(-1, std::ios::end);
-    auto len = (size_t) is.tellg();
-    is.seekg(0, std::ios::beg);
-    code.resize(len + 1);
-    is.read(code.data(), len);
-  } else {
-    auto entryName = std::regex_replace(name, std::regex("\\.nut"), ".bnut");
-    code = Locator<EngineSettings>::get().readBuffer(entryName);
-
-    // decode bnut
-    int cursor = static_cast<int>(code.size() - 1) & 0xff;
-    for (char &i : code) {
-      i ^= _bnutPass[cursor];
-      cursor = (cursor + 1) % 4096;
-    }
+    code = settings.readBuffer(name);
+    code.push_back('\0');
+    return SQ_SUCCEEDED(sq_compilebuffer(m_vm, code.data(), code.size() - 1, _SC(name.data()), SQTrue));
+  }
+
+  // prefer the bytecode compiled during a previous run
+  auto entryName = std::regex_replace(name, std::regex("\\.nut"), ".bnut");
+  const auto &cache = Locator<AssetCache>::get();
+  std::vector<char> bytecode;
+  if (cache.read("bytecode", entryName, bytecode)) {
+    BytecodeReader reader{bytecode};
+    if (SQ_SUCCEEDED(sq_readclosure(m_vm, readBytecode, &reader)))
+      return true;
+    warn("Invalid bytecode for {}, compile it", entryName);
+  }
+
+  code = settings.readBuffer(entryName);
+
+  // decode bnut
+  int cursor = static_cast<int>(code.size() - 1) & 0xff;
+  for (char &i : code) {
+    i ^= _bnutPass[cursor];
+    cursor = (cursor + 1) % 4096;
   }
 
 #if 0
@@ -372,10 +406,24 @@ void ScriptEngine::executeNutScript(const std::string &name) {
   o.write(code.data(), code.size());
   o.close();
 #endif
+  if (SQ_FAILED(sq_compilebuffer(m_vm, code.data(), code.size() - 1, _SC(name.data()), SQTrue)))
+    return false;
+
+  if (cache.isEnabled()) {
+    bytecode.clear();
+    if (SQ_SUCCEEDED(sq_writeclosure(m_vm, writeBytecode, &bytecode))) {
+      cache.write("bytecode", entryName, bytecode);
+    }
+  }
+  return true;
+}
+
+void ScriptEngine::executeNutScript(const std::string &name) {
   auto top = sq_gettop(m_vm);
   sq_pushroottable(m_vm);
-  if (SQ_FAILED(sq_compilebuffer(m_vm, code.data(), code.size() - 1, _SC(name.data()), SQTrue))) {
+  if (!compileNutScript(name)) {
     error("Error compiling {}", name);
+    sq_settop(m_vm, top);
     return;
   }
   sq_push(m_vm, -2);
@@ -383,6 +431,7 @@ void ScriptEngine::executeNutScript(const std::string &name) {
   if (SQ_FAILED(sq_call(m_vm, 1, SQFalse, SQTrue))) {
     error("Error calling {}", name);
     sqstd_printcallstack(m_vm);
+    sq_settop(m_vm, top);
     return;
   }
   sq_settop(m_vm, top);
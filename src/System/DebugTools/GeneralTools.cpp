@@ -3,10 +3,14 @@
 #include <engge/Dialog/DialogManager.hpp>
 #include <engge/Scripting/ScriptEngine.hpp>
 #include <engge/Engine/Preferences.hpp>
+#include <engge/Engine/AssetCache.hpp>
+#include <engge/System/Locator.hpp>
 #include <engge/Engine/EntityManager.hpp>
 #include <engge/Engine/ThreadBase.hpp>
+#include <engge/Graphics/ResourceManager.hpp>
 #include "Engine/DebugFeatures.hpp"
 #include "DebugControls.hpp"
+#include "TextureTools.hpp"
 #include <squirrel.h>
 #include <Util/Util.hpp>
 #include "../../extlibs/squirrel/squirrel/sqvm.h"
@@ -55,11 +59,31 @@ void GeneralTools::render() {
   }
   ImGui::Separator();
 
+  const auto &resourceManager = m_engine.getResourceManager();
+  const auto &stats = resourceManager.getStats();
+  auto textureBytes = TextureTools::convertSize(stats.textureBytes);
+  auto textureBudget = TextureTools::convertSize(resourceManager.getTextureBudget());
+  auto spriteSheetBytes = TextureTools::convertSize(stats.spriteSheetBytes);
+  auto spriteSheetBudget = TextureTools::convertSize(resourceManager.getSpriteSheetBudget());
+  ImGui::Text("Textures: %s / %s", textureBytes.data(), textureBudget.data());
+  ImGui::Text("Sprite sheets: %s / %s", spriteSheetBytes.data(), spriteSheetBudget.data());
+  ImGui::Text("Resources: %zu hits, %zu misses, %zu evictions", stats.hits, stats.misses, stats.evictions);
+  ImGui::Separator();
+
   auto gameSpeedFactor = m_engine.getPreferences().getUserPreference(PreferenceNames::EnggeGameSpeedFactor,
                                                                      PreferenceDefaultValues::EnggeGameSpeedFactor);
   if (ImGui::SliderFloat("Game speed factor", &gameSpeedFactor, 0.f, 5.f)) {
     m_engine.getPreferences().setUserPreference(PreferenceNames::EnggeGameSpeedFactor, gameSpeedFactor);
   }
+  auto assetCache = m_engine.getPreferences().getUserPreference(PreferenceNames::EnggeAssetCache,
+                                                                PreferenceDefaultValues::EnggeAssetCache);
+  if (ImGui::Checkbox("Asset cache", &assetCache)) {
+    m_engine.getPreferences().setUserPreference(PreferenceNames::EnggeAssetCache, assetCache);
+  }
+  ImGui::SameLine();
+  if (ImGui::SmallButton("Clear cache")) {
+    Locator<AssetCache>::get().clear();
+  }
   ImGui::Checkbox("Show cursor position", &DebugFeatures::showCursorPosition);
   ImGui::Checkbox("Show hovered object", &DebugFeatures::showHoveredObject);
   ImGui::Checkbox("Show text bounds", &DebugFeatures::showTextBounds);
@@ -6,10 +6,9 @@ class TextureTools final {
 public:
   void render();
 
+  static std::string convertSize(size_t size);
+
 public:
   bool texturesVisible{false};
-
-private:
-  static std::string convertSize(size_t size);
 };
 }
\ No newline at end of file
@@ -31,7 +31,8 @@ void Checkbox::setSpriteSheet(SpriteSheet *pSpriteSheet) {
   glm::vec2 scale(Screen::Width / 320.f, Screen::Height / 180.f);
   m_sprite.getTransform().setScale(scale);
   m_sprite.getTransform().setOrigin({checkedRect.getWidth() / 2.f, checkedRect.getHeight() / 2.f});
-  m_sprite.setTexture(*pSpriteSheet->getTexture());
+  m_texture = pSpriteSheet->getTexture();
+  m_sprite.setTexture(*m_texture);
   m_sprite.setTextureRect(checkedRect);
 
   updateCheckState();
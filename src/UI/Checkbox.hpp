@@ -1,4 +1,5 @@
 #pragma once
+#include <memory>
 #include <utility>
 #include <ngf/Graphics/Drawable.h>
 #include <ngf/Graphics/Sprite.h>
@@ -33,6 +34,7 @@ private:
   bool m_isChecked{false};
   ng::Text m_text;
   ngf::Sprite m_sprite;
+  std::shared_ptr<ngf::Texture> m_texture;
   SpriteSheet *m_pSpriteSheet{nullptr};
 };
 }
@@ -105,6 +105,8 @@ struct HelpDialog::Impl {
   std::vector<int> m_pages;
   ngf::Sprite m_backgroundSprite;
   ngf::Sprite m_helpPageSprite;
+  std::shared_ptr<ngf::Texture> m_backgroundTexture;
+  std::shared_ptr<ngf::Texture> m_helpPageTexture;
   int m_pageIndex{0};
 
   Impl()
@@ -135,7 +137,8 @@ struct HelpDialog::Impl {
     m_prev.setEngine(pEngine);
     m_next.setEngine(pEngine);
 
-    m_backgroundSprite.setTexture(*m_pEngine->getResourceManager().getTexture("HelpScreen_bg"));
+    m_backgroundTexture = m_pEngine->getResourceManager().getTexture("HelpScreen_bg");
+    m_backgroundSprite.setTexture(*m_backgroundTexture);
     m_backgroundSprite.getTransform().setPosition({Screen::HalfWidth, Screen::HalfHeight});
     m_backgroundSprite.setAnchor(ngf::Anchor::Center);
 
@@ -158,7 +161,8 @@ struct HelpDialog::Impl {
     sprintf(background, "HelpScreen_%02d_en", m_pages[index]);
     std::string backgroundWithLang = background;
     checkLanguage(backgroundWithLang);
-    m_helpPageSprite.setTexture(*m_pEngine->getResourceManager().getTexture(backgroundWithLang));
+    m_helpPageTexture = m_pEngine->getResourceManager().getTexture(backgroundWithLang);
+    m_helpPageSprite.setTexture(*m_helpPageTexture);
     m_helpPageSprite.setAnchor(ngf::Anchor::Center);
   }
 
@@ -122,7 +122,8 @@ struct SaveLoadDialog::Impl {
 
       // prepare the sprite for the frame
       auto rect = spriteSheet.getRect("saveload_slot_frame");
-      m_sprite.setTexture(*spriteSheet.getTexture());
+      m_sheetTexture = spriteSheet.getTexture();
+      m_sprite.setTexture(*m_sheetTexture);
       m_sprite.getTransform().setOrigin({static_cast<float>(rect.getWidth() / 2.f),
                                          static_cast<float>(rect.getHeight() / 2.f)});
       m_sprite.getTransform().setScale({4, 4});
@@ -149,7 +150,7 @@ struct SaveLoadDialog::Impl {
 
       // or prepare a sprite for the savegame empty slot
       auto saveslotRect = spriteSheet.getRect("saveload_slot");
-      m_spriteImg.setTexture(*spriteSheet.getTexture());
+      m_spriteImg.setTexture(*m_sheetTexture);
       m_spriteImg.setTextureRect(saveslotRect);
       m_spriteImg.getTransform().setOrigin({static_cast<float>(saveslotRect.getWidth() / 2.f),
                                             static_cast<float>(saveslotRect.getHeight() / 2.f)});
@@ -180,6 +181,7 @@ struct SaveLoadDialog::Impl {
     int m_index{0};
     bool m_isEmpty{true};
     ngf::Texture m_texture;
+    std::shared_ptr<ngf::Texture> m_sheetTexture;
     ngf::Sprite m_sprite, m_spriteImg;
     ng::Text m_gameTimeText;
     ng::Text m_saveTimeText;
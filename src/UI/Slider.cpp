@@ -25,7 +25,8 @@ void Slider::setSpriteSheet(SpriteSheet *pSpriteSheet) {
   m_sprite.getTransform().setPosition({Screen::Width / 2.f, m_y});
   m_sprite.getTransform().setScale(scale);
   m_sprite.getTransform().setOrigin({sliderRect.getWidth() / 2.f, 0});
-  m_sprite.setTexture(*pSpriteSheet->getTexture());
+  m_texture = pSpriteSheet->getTexture();
+  m_sprite.setTexture(*m_texture);
   m_sprite.setTextureRect(sliderRect);
 
   m_min = Screen::Width / 2.f - (sliderRect.getWidth() * scale.x / 2.f);
@@ -34,7 +35,7 @@ void Slider::setSpriteSheet(SpriteSheet *pSpriteSheet) {
   m_spriteHandle.getTransform().setPosition({x, m_y});
   m_spriteHandle.getTransform().setScale(scale);
   m_spriteHandle.getTransform().setOrigin({handleRect.getWidth() / 2.f, 0});
-  m_spriteHandle.setTexture(*pSpriteSheet->getTexture());
+  m_spriteHandle.setTexture(*m_texture);
   m_spriteHandle.setTextureRect(handleRect);
 }
 
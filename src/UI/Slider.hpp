@@ -32,6 +32,7 @@ private:
   bool m_isDragging{false};
   ngf::Sprite m_sprite;
   ngf::Sprite m_spriteHandle;
+  std::shared_ptr<ngf::Texture> m_texture;
   ng::Text m_text;
   std::optional<Callback> m_onValueChanged;
 };